@@ -13,124 +13,10 @@ FECResult Mgnc::Can_SpawnActor(UWorld& World,
 	const FActorSpawnParameters& SpawnParams
 	)
 {
-	// NOTE: All checks are copied from UWorld::SpawnActor
-	if (ActorClass.HasAnyClassFlags(CLASS_Deprecated))
-	{
-		return EECSpawnActorResult::ClassDeprecated;
-	}
-	if (ActorClass.HasAnyClassFlags(CLASS_Abstract))
-	{
-		return EECSpawnActorResult::ClassAbstract;
-	}
-	if (!ActorClass.IsChildOf(AActor::StaticClass()))
-	{
-		return EECSpawnActorResult::ClassWasNotActor;
-	}
-	if (SpawnParams.Template && SpawnParams.Template->GetClass() != &ActorClass)
-	{
-		return EECSpawnActorResult::TemplateClassMismatch;
-	}
-	if (World.bIsRunningConstructionScript && !SpawnParams.bAllowDuringConstructionScript)
-	{
-		return EECSpawnActorResult::CalledFromConstructionScript;
-	}
-	if (World.bIsTearingDown)
-	{
-		return EECSpawnActorResult::WorldTearingDown;
-	}
-	if (Transform.ContainsNaN())
-	{
-		return EECSpawnActorResult::InvalidSpawnTransform;
-	}
-#if WITH_EDITOR
-	if (SpawnParams.OverridePackage && SpawnParams.bCreateActorPackage)
-	{
-		return EECSpawnActorResult::CannotOverrideAndCreatePackage;
-	}
-#endif
-	ULevel* LevelToSpawnIn = SpawnParams.OverrideLevel
-								? SpawnParams.OverrideLevel
-								: SpawnParams.Owner
-									? SpawnParams.Owner->GetLevel()
-									: World.GetCurrentLevel();
-	AActor* Template = SpawnParams.Template ? SpawnParams.Template : ActorClass.GetDefaultObject<AActor>();
-	check(Template);
-	FName NewActorName = SpawnParams.Name;
-	UPackage* ExternalPackage = nullptr;
-	bool bNeedGloballyUniqueName = false;
-
-#if WITH_EDITOR
-	if (SpawnParams.OverridePackage)
-	{
-		ExternalPackage = SpawnParams.OverridePackage;
-		bNeedGloballyUniqueName = true;
-	}
-	else if (LevelToSpawnIn->ShouldCreateNewExternalActors() && SpawnParams.bCreateActorPackage && !(SpawnParams.ObjectFlags & RF_Transient))
-	{
-		bNeedGloballyUniqueName = CastChecked<AActor>(ActorClass.GetDefaultObject())->SupportsExternalPackaging();
-	}
-	if (!GIsEditor)
-	{
-		bNeedGloballyUniqueName = false;
-	}
-#endif // WITH_EDITOR
-	
-	if (!NewActorName.IsNone() && (StaticFindObjectFast(nullptr, LevelToSpawnIn, NewActorName) || (bNeedGloballyUniqueName != FActorSpawnUtils::IsGloballyUniqueName(NewActorName) && SpawnParams.NameMode == FActorSpawnParameters::ESpawnActorNameMode::Requested)))
-	{
-		switch (SpawnParams.NameMode)
-		{
-			case FActorSpawnParameters::ESpawnActorNameMode::Required_Fatal:
-			case FActorSpawnParameters::ESpawnActorNameMode::Required_ErrorAndReturnNull:
-			case FActorSpawnParameters::ESpawnActorNameMode::Required_ReturnNull:
-				return EECSpawnActorResult::ObjectNameNotUnique;
-			case FActorSpawnParameters::ESpawnActorNameMode::Requested:
-				break;
-			default:
-				checkNoEntry();
-		}
-	}
-
-	if (!World.CanCreateInCurrentContext(Template))
-	{
-		return EECSpawnActorResult::NetworkContextMismatch;
-	}
-
-	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride = SpawnParams.SpawnCollisionHandlingOverride;
-	if (SpawnParams.bNoFail)
-	{
-		if (CollisionHandlingOverride == ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding)
-		{
-			CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-		}
-		else if (CollisionHandlingOverride == ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding)
-		{
-			CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		}
-	}
-	
-	const ESpawnActorCollisionHandlingMethod CollisionHandlingMethod =
-		CollisionHandlingOverride == ESpawnActorCollisionHandlingMethod::Undefined
-			? Template->SpawnCollisionHandlingMethod
-			: CollisionHandlingOverride;
-
-	if (CollisionHandlingMethod == ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding)
-	{
-		USceneComponent* const TemplateRootComponent = Template->GetRootComponent();
-
-		const FTransform FinalRootComponentTransform = TemplateRootComponent
-															? TemplateRootComponent->GetRelativeTransform() * Transform
-															: Transform;
-
-		const FVector FinalRootLocation = FinalRootComponentTransform.GetLocation();
-		const FRotator FinalRootRotation = FinalRootComponentTransform.Rotator();
-		// Unclear why UWorld::EncroachingBlockingGeometry is not const; probably an oversight
-		if (World.EncroachingBlockingGeometry(Template, FinalRootLocation, FinalRootRotation))
-		{
-			return EECSpawnActorResult::SpawnCollisionBlocked;
-		}
-	}
+	TECValueOrResult<FECSpawnPlan> Plan = FECSpawnPlan::Prepare(World, ActorClass, SpawnParams);
+	EC_VALIDATE(Plan.GetResult());
 
-	return {};
+	return Plan.GetValue().Can_Execute(Transform);
 }
 
 FECResult Mgnc::Exec_SpawnActor(AActor*& OutSpawnedActor,
@@ -158,11 +44,98 @@ FECResult Mgnc::Try_SpawnActor(AActor*& OutSpawnedActor,
 	const FActorSpawnParameters& SpawnParams
 	)
 {
+	OutSpawnedActor = nullptr;
 	EC_VALIDATE(Can_SpawnActor(World, ActorClass, Transform, SpawnParams));
 
+	// Spawn with the caller's parameters, so the actor's collision handling is the same as with 'UWorld::SpawnActor'.
+	// Only explicit spawn plans skip the engine's collision check.
+	return Exec_SpawnActor(OutSpawnedActor, World, ActorClass, Transform, SpawnParams);
+}
+
+FECResult Mgnc::Exec_SpawnActor(AActor*& OutSpawnedActor,
+	UWorld& World,
+	UClass& ActorClass,
+	const FTransform& Transform,
+	const FActorSpawnParameters& SpawnParams,
+	const FECCancellationToken& Cancellation,
+	const FECDeadline& Deadline
+	)
+{
+	OutSpawnedActor = nullptr;
+	EC_VALIDATE(CheckStopRequested(Cancellation, Deadline));
+
 	return Exec_SpawnActor(OutSpawnedActor, World, ActorClass, Transform, SpawnParams);
 }
 
+FECResult Mgnc::Try_SpawnActor(AActor*& OutSpawnedActor,
+	UWorld& World,
+	UClass& ActorClass,
+	const FTransform& Transform,
+	const FActorSpawnParameters& SpawnParams,
+	const FECCancellationToken& Cancellation,
+	const FECDeadline& Deadline
+	)
+{
+	OutSpawnedActor = nullptr;
+	EC_VALIDATE(CheckStopRequested(Cancellation, Deadline));
+
+	return Try_SpawnActor(OutSpawnedActor, World, ActorClass, Transform, SpawnParams);
+}
+
+FECPackedResults Mgnc::Try_SpawnActorBatch(TArray<AActor*>& OutSpawnedActors,
+	UWorld& World,
+	UClass& ActorClass,
+	TConstArrayView<FTransform> Transforms,
+	TConstArrayView<FActorSpawnParameters> SpawnParams,
+	const FECCancellationToken& Cancellation
+	)
+{
+	checkf(SpawnParams.Num() == 1 || SpawnParams.Num() == Transforms.Num(),
+		TEXT("Expected 1 or %d spawn parameters, got %d."), Transforms.Num(), SpawnParams.Num());
+
+	const int32 NumInstances = Transforms.Num();
+	FECPackedResults Results;
+	Results.Reserve(NumInstances);
+	OutSpawnedActors.Reset(NumInstances);
+	OutSpawnedActors.SetNumZeroed(NumInstances);
+
+	const auto GetInstanceParams = [&SpawnParams](int32 Index) -> const FActorSpawnParameters&
+	{
+		return SpawnParams[SpawnParams.Num() == 1 ? 0 : Index];
+	};
+
+	// Consecutive instances usually share their parameters, so keep the last plan until one can't use it.
+	TOptional<TECValueOrResult<FECSpawnPlan>> Plan;
+	const FActorSpawnParameters* PlanParams = nullptr;
+	for (int32 Index = 0; Index < NumInstances; ++Index)
+	{
+		if (Cancellation.IsCancellationRequested())
+		{
+			Results.Add(EECOperationResult::Cancelled);
+			continue;
+		}
+
+		const FActorSpawnParameters& InstanceParams = GetInstanceParams(Index);
+		const bool bCanReusePlan = Plan.IsSet()
+			&& (PlanParams == &InstanceParams || (Plan->HasValue() && Plan->GetValue().CanShareWith(InstanceParams)));
+		if (!bCanReusePlan)
+		{
+			Plan.Emplace(FECSpawnPlan::Prepare(World, ActorClass, InstanceParams));
+			PlanParams = &InstanceParams;
+		}
+
+		if (!Plan->HasValue())
+		{
+			Results.Add(Plan->GetResult());
+			continue;
+		}
+		// Required names taken by earlier instances are found in the level by the plan's per-spawn name check.
+		Results.Add(Plan->GetValue().Try_Execute(OutSpawnedActors[Index], Transforms[Index], InstanceParams));
+	}
+
+	return Results;
+}
+
 FActorSpawnParameters Mgnc::Detail::InitDeferredActorSpawnParams(AActor* Owner,
 	APawn* Instigator,
 	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride
@@ -0,0 +1,43 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECAsyncAction_LoadAsset.h"
+
+UECAsyncAction_LoadAsset* UECAsyncAction_LoadAsset::LoadAssetWithResult(UObject* WorldContextObject,
+	TSoftObjectPtr<UObject> Asset
+	)
+{
+	UECAsyncAction_LoadAsset* Action = NewObject<UECAsyncAction_LoadAsset>();
+	Action->Asset = Asset;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UECAsyncAction_LoadAsset::Activate()
+{
+	RequestAsyncLoad(Asset.ToSoftObjectPath(), [this](const FECResult& Result, UObject* Object)
+	{
+		LoadedAsset = Object;
+		Complete(Result);
+	});
+}
+
+void UECAsyncAction_LoadAsset::OnCancelRequested()
+{
+	Complete(EECOperationResult::Cancelled);
+}
+
+void UECAsyncAction_LoadAsset::BroadcastResult(const FECResult& Result)
+{
+	if (Result.IsSuccess())
+	{
+		OnSuccess.Broadcast(Result, LoadedAsset);
+	}
+	else
+	{
+		OnFailure.Broadcast(Result, nullptr);
+	}
+}
@@ -0,0 +1,68 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECAsyncAction_Result.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+void UECAsyncAction_Result::Cancel()
+{
+	if (bIsComplete)
+	{
+		return;
+	}
+
+	Cancellation.Cancel();
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+	OnCancelRequested();
+}
+
+void UECAsyncAction_Result::Complete(const FECResult& Result)
+{
+	if (bIsComplete)
+	{
+		return;
+	}
+
+	bIsComplete = true;
+	BroadcastResult(Result);
+	SetReadyToDestroy();
+}
+
+void UECAsyncAction_Result::RequestAsyncLoad(const FSoftObjectPath& Path,
+	TFunction<void(const FECResult&, UObject*)> OnLoaded
+	)
+{
+	if (Path.IsNull())
+	{
+		OnLoaded(EECAsyncLoadResult::InvalidPath, nullptr);
+		return;
+	}
+
+	if (UObject* LoadedObject = Path.ResolveObject())
+	{
+		OnLoaded(FECResult::Success(), LoadedObject);
+		return;
+	}
+
+	LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Path,
+		FStreamableDelegate::CreateWeakLambda(this, [this, Path, OnLoaded = MoveTemp(OnLoaded)]()
+		{
+			LoadHandle.Reset();
+			if (Cancellation.IsCancellationRequested())
+			{
+				return;
+			}
+
+			UObject* LoadedObject = Path.ResolveObject();
+			OnLoaded(LoadedObject ? FECResult::Success() : FECResult(EECAsyncLoadResult::LoadFailed), LoadedObject);
+		}));
+}
@@ -0,0 +1,67 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECAsyncAction_Retry.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UECAsyncAction_Retry* UECAsyncAction_Retry::RetryWithBackoff(UObject* WorldContextObject,
+	FECRetryAttemptDynamic Attempt,
+	const FECRetryPolicy& Policy
+	)
+{
+	UECAsyncAction_Retry* Action = NewObject<UECAsyncAction_Retry>();
+	Action->World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	Action->Attempt = Attempt;
+	Action->Policy = Policy;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UECAsyncAction_Retry::Activate()
+{
+	UWorld* ActionWorld = World.Get();
+	if (!ActionWorld)
+	{
+		Complete(EECOperationResult::Cancelled);
+		return;
+	}
+
+	Mgnc::RetryWithBackoff(
+		*ActionWorld,
+		Policy,
+		[WeakThis = TWeakObjectPtr<UECAsyncAction_Retry>(this)]() -> FECResult
+		{
+			// The event's owner was destroyed, so there's nobody left to retry for.
+			if (!WeakThis.IsValid() || !WeakThis->Attempt.IsBound())
+			{
+				return EECOperationResult::Cancelled;
+			}
+			return WeakThis->Attempt.Execute();
+		},
+		[WeakThis = TWeakObjectPtr<UECAsyncAction_Retry>(this)](const FECResult& Result, int32 NumAttempts)
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->NumAttemptsMade = NumAttempts;
+				WeakThis->Complete(Result);
+			}
+		},
+		Cancellation);
+}
+
+void UECAsyncAction_Retry::BroadcastResult(const FECResult& Result)
+{
+	if (Result.IsSuccess())
+	{
+		OnSuccess.Broadcast(Result, NumAttemptsMade);
+	}
+	else
+	{
+		OnFailure.Broadcast(Result, NumAttemptsMade);
+	}
+}
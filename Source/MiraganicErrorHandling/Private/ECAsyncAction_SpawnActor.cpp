@@ -0,0 +1,84 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECAsyncAction_SpawnActor.h"
+
+#include "ECActorSpawning.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UECAsyncAction_SpawnActor* UECAsyncAction_SpawnActor::SpawnActorWithResult(UObject* WorldContextObject,
+	TSoftClassPtr<AActor> ActorClass,
+	const FTransform& SpawnTransform,
+	ESpawnActorCollisionHandlingMethod CollisionHandling,
+	AActor* Owner
+	)
+{
+	UECAsyncAction_SpawnActor* Action = NewObject<UECAsyncAction_SpawnActor>();
+	Action->World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	Action->ActorClass = ActorClass;
+	Action->SpawnTransform = SpawnTransform;
+	Action->CollisionHandling = CollisionHandling;
+	Action->Owner = Owner;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UECAsyncAction_SpawnActor::Activate()
+{
+	RequestAsyncLoad(ActorClass.ToSoftObjectPath(), [this](const FECResult& Result, UObject* Object)
+	{
+		if (Result.IsFailure())
+		{
+			Complete(Result);
+			return;
+		}
+		SpawnLoadedClass(Cast<UClass>(Object));
+	});
+}
+
+void UECAsyncAction_SpawnActor::OnCancelRequested()
+{
+	Complete(EECOperationResult::Cancelled);
+}
+
+void UECAsyncAction_SpawnActor::BroadcastResult(const FECResult& Result)
+{
+	if (Result.IsSuccess())
+	{
+		OnSuccess.Broadcast(Result, SpawnedActor);
+	}
+	else
+	{
+		OnFailure.Broadcast(Result, nullptr);
+	}
+}
+
+void UECAsyncAction_SpawnActor::SpawnLoadedClass(UClass* LoadedClass)
+{
+	UWorld* SpawnWorld = World.Get();
+	if (!SpawnWorld)
+	{
+		// The world was torn down while the class was loading.
+		Complete(EECSpawnActorResult::WorldTearingDown);
+		return;
+	}
+	if (!LoadedClass)
+	{
+		Complete(EECAsyncLoadResult::LoadFailed);
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Owner.Get();
+	SpawnParams.SpawnCollisionHandlingOverride = CollisionHandling;
+
+	AActor* Actor = nullptr;
+	const FECResult Result = Mgnc::Try_SpawnActor(Actor, *SpawnWorld, *LoadedClass, SpawnTransform, SpawnParams,
+		Cancellation);
+	SpawnedActor = Actor;
+	Complete(Result);
+}
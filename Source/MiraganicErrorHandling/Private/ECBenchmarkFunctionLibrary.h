@@ -0,0 +1,29 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ECBenchmarkFunctionLibrary.generated.h"
+
+/**
+ * By-value copies of UECErrorFunctionLibrary predicates, used by 'ec.Bench.BlueprintCalls' as the baseline for the
+ * const reference versions. Not exposed to Blueprint.
+ */
+UCLASS(MinimalAPI)
+class UECBenchmarkFunctionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	static bool IsFailure_ByValue(FECResult Result);
+
+	UFUNCTION()
+	static bool Equal_ResultResult_ByValue(FECResult A, FECResult B);
+};
@@ -0,0 +1,166 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "CoreMinimal.h"
+#include "ECBenchmarkFunctionLibrary.h"
+#include "ECCancellation.h"
+#include "ECErrorFunctionLibrary.h"
+#include "ECErrorMacros.h"
+#include "HAL/IConsoleManager.h"
+
+bool UECBenchmarkFunctionLibrary::IsFailure_ByValue(FECResult Result)
+{
+	return Result.IsFailure();
+}
+
+bool UECBenchmarkFunctionLibrary::Equal_ResultResult_ByValue(FECResult A, FECResult B)
+{
+	return A == B;
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace Mgnc::Detail::Bench
+{
+static constexpr int32 ChainDepth = 8;
+
+// Read through a volatile so the compiler can't fold the chain away.
+static volatile int32 GFailAtDepth = -1;
+
+/**
+ * One link of a chain of validated calls. 'bOutlined' selects EC_VALIDATE_OR_LOG; otherwise the failure path is the
+ * inline EC_LOG_RESULT expansion the macro used before it was outlined.
+ *
+ * Code size can be compared with the platform's symbol tool (E.g., 'nm -S --size-sort' or 'dumpbin /symbols') on the
+ * ValidateChainStep<N, 0> and ValidateChainStep<N, 1> instantiations.
+ */
+template<int32 Depth, bool bOutlined>
+FORCENOINLINE FECResult ValidateChainStep(int32 FailAtDepth)
+{
+	if constexpr (Depth == 0)
+	{
+		return FailAtDepth == 0 ? FECResult(EECOperationResult::Cancelled) : FECResult::Success();
+	}
+	else if constexpr (bOutlined)
+	{
+		EC_VALIDATE_OR_LOG(ValidateChainStep<Depth - 1, bOutlined>(FailAtDepth), return EECOperationResult::Cancelled);
+		return FailAtDepth == Depth ? FECResult(EECOperationResult::Cancelled) : FECResult::Success();
+	}
+	else
+	{
+		const FECResult Result = ValidateChainStep<Depth - 1, bOutlined>(FailAtDepth);
+		if (Result.IsFailure())
+		{
+			EC_LOG_RESULT(LogErrorHandling, Error, Result);
+			return EECOperationResult::Cancelled;
+		}
+		return FailAtDepth == Depth ? FECResult(EECOperationResult::Cancelled) : FECResult::Success();
+	}
+}
+
+template<bool bOutlined>
+static double TimeValidateChain(int32 NumIterations)
+{
+	int32 NumFailures = 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		NumFailures += ValidateChainStep<ChainDepth, bOutlined>(GFailAtDepth).IsFailure() ? 1 : 0;
+	}
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	check(NumFailures == 0);
+
+	return FPlatformTime::ToSeconds64(EndCycles - StartCycles) * 1e9 / (static_cast<double>(NumIterations) * ChainDepth);
+}
+
+static void BenchmarkValidateChain(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	const int32 NumIterations = FMath::Max(Args.IsEmpty() ? 1000000 : FCString::Atoi(*Args[0]), 1);
+
+	// Warm up both chains, then alternate so frequency scaling affects them equally.
+	TimeValidateChain<false>(NumIterations / 10 + 1);
+	TimeValidateChain<true>(NumIterations / 10 + 1);
+	const double InlineNs = (TimeValidateChain<false>(NumIterations) + TimeValidateChain<false>(NumIterations)) / 2.0;
+	const double OutlinedNs = (TimeValidateChain<true>(NumIterations) + TimeValidateChain<true>(NumIterations)) / 2.0;
+
+	Ar.Logf(TEXT("Validated call chain, depth %d, %d iterations, success path:"), ChainDepth, NumIterations);
+	Ar.Logf(TEXT("  Inline logging:   %.2f ns per validated call"), InlineNs);
+	Ar.Logf(TEXT("  Outlined logging: %.2f ns per validated call (%+.1f%%)"), OutlinedNs,
+		InlineNs > 0.0 ? (OutlinedNs / InlineNs - 1.0) * 100.0 : 0.0);
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice CmdBenchValidateChain(
+	TEXT("ec.Bench.ValidateChain"),
+	TEXT("Time a chain of EC_VALIDATE_OR_LOG calls against the same chain with inline logging. Usage: ec.Bench.ValidateChain [Iterations]"),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkValidateChain));
+
+// Call a static UFUNCTION through its reflected thunk, which is how the Blueprint VM calls native functions. Returns
+// calls per second.
+static double TimeReflectedCalls(UFunction& Function, const FECResult& A, const FECResult& B, int32 NumIterations)
+{
+	UObject* Target = Function.GetOwnerClass()->GetDefaultObject();
+	uint8* Params = static_cast<uint8*>(FMemory_Alloca(Function.ParmsSize));
+	FMemory::Memzero(Params, Function.ParmsSize);
+	Function.InitializeStruct(Params);
+
+	int32 ArgIdx = 0;
+	for (TFieldIterator<FProperty> It(&Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		if (!It->HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			It->CopyCompleteValue(It->ContainerPtrToValuePtr<void>(Params), ArgIdx++ == 0 ? &A : &B);
+		}
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Target->ProcessEvent(&Function, Params);
+	}
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+
+	Function.DestroyStruct(Params);
+	return NumIterations / FMath::Max(FPlatformTime::ToSeconds64(EndCycles - StartCycles), UE_DOUBLE_SMALL_NUMBER);
+}
+
+static void BenchmarkBlueprintCalls(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	const int32 NumIterations = FMath::Max(Args.IsEmpty() ? 1000000 : FCString::Atoi(*Args[0]), 1);
+	const FECResult A = EECOperationResult::Cancelled;
+	const FECResult B = EECOperationResult::DeadlineExceeded;
+
+	const TPair<FName, FName> Pairs[] = {
+		{GET_FUNCTION_NAME_CHECKED(UECBenchmarkFunctionLibrary, IsFailure_ByValue),
+			GET_FUNCTION_NAME_CHECKED(UECErrorFunctionLibrary, IsFailure)},
+		{GET_FUNCTION_NAME_CHECKED(UECBenchmarkFunctionLibrary, Equal_ResultResult_ByValue),
+			GET_FUNCTION_NAME_CHECKED(UECErrorFunctionLibrary, Equal_ResultResult)},
+	};
+
+	Ar.Logf(TEXT("Reflected calls, %d iterations:"), NumIterations);
+	for (const TPair<FName, FName>& Pair : Pairs)
+	{
+		UFunction* ByValue = UECBenchmarkFunctionLibrary::StaticClass()->FindFunctionByName(Pair.Key);
+		UFunction* ByRef = UECErrorFunctionLibrary::StaticClass()->FindFunctionByName(Pair.Value);
+		check(ByValue && ByRef);
+
+		// Warm up, then alternate so frequency scaling affects both equally.
+		TimeReflectedCalls(*ByValue, A, B, NumIterations / 10 + 1);
+		TimeReflectedCalls(*ByRef, A, B, NumIterations / 10 + 1);
+		const double ByValueRate = (TimeReflectedCalls(*ByValue, A, B, NumIterations) + TimeReflectedCalls(*ByValue, A, B, NumIterations)) / 2.0;
+		const double ByRefRate = (TimeReflectedCalls(*ByRef, A, B, NumIterations) + TimeReflectedCalls(*ByRef, A, B, NumIterations)) / 2.0;
+
+		Ar.Logf(TEXT("  %s: %.2fM calls/s by value, %.2fM calls/s by const reference (%+.1f%%)"), *Pair.Value.ToString(),
+			ByValueRate / 1e6, ByRefRate / 1e6, (ByRefRate / ByValueRate - 1.0) * 100.0);
+	}
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice CmdBenchBlueprintCalls(
+	TEXT("ec.Bench.BlueprintCalls"),
+	TEXT("Compare calls per second of by-value and const reference result predicates called through their reflected thunks. Usage: ec.Bench.BlueprintCalls [Iterations]"),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkBlueprintCalls));
+} // namespace Mgnc::Detail::Bench
+
+#endif
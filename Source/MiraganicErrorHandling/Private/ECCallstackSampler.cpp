@@ -0,0 +1,355 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECCallstackSampler.h"
+
+#include "ECLogging.h"
+#include "ECStats.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformStackWalk.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/Paths.h"
+
+namespace Mgnc::Detail
+{
+static TAutoConsoleVariable<bool> CVarCallstacksEnable(
+	TEXT("ec.Callstacks.Enable"),
+	false,
+	TEXT("Capture callstacks for a sample of reported failures."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCallstacksSampleEveryN(
+	TEXT("ec.Callstacks.SampleEveryN"),
+	0,
+	TEXT("Capture a callstack for one in every N failures of a category. 0 captures the first failures each minute, up to ec.Callstacks.MaxPerMinute."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCallstacksMaxPerMinute(
+	TEXT("ec.Callstacks.MaxPerMinute"),
+	10,
+	TEXT("Maximum number of callstacks captured per category per minute."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarCallstacksSymbolicate(
+	TEXT("ec.Callstacks.Symbolicate"),
+	true,
+	TEXT("Symbolicate captured callstacks on a background task. If disabled, module+offset frames are logged for offline decoding."),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdCallstacksSetCategoryPolicy(
+	TEXT("ec.Callstacks.SetCategoryPolicy"),
+	TEXT("Override callstack sampling for a category. Usage: ec.Callstacks.SetCategoryPolicy <Category> <SampleEveryN> <MaxPerMinute>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() != 3)
+		{
+			UE_LOG(LogErrorHandling, Warning, TEXT("Usage: ec.Callstacks.SetCategoryPolicy <Category> <SampleEveryN> <MaxPerMinute>"));
+			return;
+		}
+
+		const UEnum* Category = FindFirstObject<UEnum>(*Args[0], EFindFirstObjectOptions::None);
+		if (!Category)
+		{
+			UE_LOG(LogErrorHandling, Warning, TEXT("Unknown error category '%s'."), *Args[0]);
+			return;
+		}
+
+		FECCallstackSamplingPolicy Policy;
+		Policy.SampleEveryN = FCString::Atoi(*Args[1]);
+		Policy.MaxPerMinute = FCString::Atoi(*Args[2]);
+		FECCallstackSampler::Get().SetCategoryPolicy(*Category, Policy);
+	}));
+} // namespace Mgnc::Detail
+
+FECCallstackSampler& FECCallstackSampler::Get()
+{
+	static FECCallstackSampler Sampler;
+	return Sampler;
+}
+
+void FECCallstackSampler::Startup()
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FECCallstackSampler::Tick), 1.f);
+}
+
+void FECCallstackSampler::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	if (PendingSymbolication.IsValid())
+	{
+		PendingSymbolication.Wait();
+	}
+	CallstackFile.Reset();
+}
+
+void FECCallstackSampler::SampleFailure(const FECResult& Result)
+{
+	if (!Mgnc::Detail::CVarCallstacksEnable.GetValueOnAnyThread() || !ShouldSample(Result))
+	{
+		return;
+	}
+
+	Capture(Result);
+}
+
+void FECCallstackSampler::SetCategoryPolicy(const UEnum& Category, const FECCallstackSamplingPolicy& Policy)
+{
+	if (FCategoryState* State = FindCategoryState(&Category))
+	{
+		State->PackedPolicy.store(PackPolicy(Policy), std::memory_order_relaxed);
+	}
+}
+
+void FECCallstackSampler::ClearCategoryPolicy(const UEnum& Category)
+{
+	if (FCategoryState* State = FindCategoryState(&Category))
+	{
+		State->PackedPolicy.store(0, std::memory_order_relaxed);
+	}
+}
+
+uint64 FECCallstackSampler::PackPolicy(const FECCallstackSamplingPolicy& Policy)
+{
+	// The top bit marks an override, so a policy of all zeros can still be stored.
+	return (1ull << 63)
+		| static_cast<uint64>(static_cast<uint32>(FMath::Max(Policy.SampleEveryN, 0)) & 0x7fffffffu) << 32
+		| static_cast<uint32>(Policy.MaxPerMinute);
+}
+
+FECCallstackSamplingPolicy FECCallstackSampler::UnpackPolicy(uint64 PackedPolicy)
+{
+	FECCallstackSamplingPolicy Policy;
+	Policy.SampleEveryN = static_cast<int32>((PackedPolicy >> 32) & 0x7fffffffu);
+	Policy.MaxPerMinute = static_cast<int32>(static_cast<uint32>(PackedPolicy));
+	return Policy;
+}
+
+FECCallstackSampler::FCategoryState* FECCallstackSampler::FindCategoryState(const UEnum* Category)
+{
+	static_assert(FMath::IsPowerOfTwo(MaxCategories), "MaxCategories must be a power of two.");
+
+	if (!Category)
+	{
+		// Null can't be a slot's key, since it marks free slots.
+		return &InvalidCategoryState;
+	}
+
+	// Open addressing: a category keeps the first slot it claims, so lookups never need a lock.
+	const uint32 Start = GetTypeHash(Category);
+	for (uint32 Probe = 0; Probe < MaxCategories; ++Probe)
+	{
+		FCategoryState& State = Categories[(Start + Probe) & (MaxCategories - 1)];
+		const UEnum* SlotCategory = State.Category.load(std::memory_order_acquire);
+		if (SlotCategory == nullptr
+			&& State.Category.compare_exchange_strong(SlotCategory, Category, std::memory_order_acq_rel))
+		{
+			return &State;
+		}
+		if (SlotCategory == Category)
+		{
+			return &State;
+		}
+	}
+	return nullptr;
+}
+
+bool FECCallstackSampler::ShouldSample(const FECResult& Result)
+{
+	FCategoryState* State = FindCategoryState(Result.GetCategory());
+	if (!State)
+	{
+		return false;
+	}
+
+	const uint64 PackedPolicy = State->PackedPolicy.load(std::memory_order_relaxed);
+	const FECCallstackSamplingPolicy Policy = PackedPolicy != 0
+		? UnpackPolicy(PackedPolicy)
+		: FECCallstackSamplingPolicy{
+			Mgnc::Detail::CVarCallstacksSampleEveryN.GetValueOnAnyThread(),
+			Mgnc::Detail::CVarCallstacksMaxPerMinute.GetValueOnAnyThread()};
+
+	// Whichever thread sees the new minute first resets the count. A capture racing with the reset may be counted in
+	// either minute, which is fine for sampling.
+	const int64 Minute = static_cast<int64>(FPlatformTime::Seconds() / 60.0);
+	int64 StateMinute = State->Minute.load(std::memory_order_relaxed);
+	if (StateMinute != Minute && State->Minute.compare_exchange_strong(StateMinute, Minute, std::memory_order_relaxed))
+	{
+		State->NumCapturedThisMinute.store(0, std::memory_order_relaxed);
+	}
+
+	const uint32 FailureIdx = State->NumFailures.fetch_add(1, std::memory_order_relaxed);
+	if (State->NumCapturedThisMinute.load(std::memory_order_relaxed) >= Policy.MaxPerMinute)
+	{
+		return false;
+	}
+	if (Policy.SampleEveryN > 1 && FailureIdx % Policy.SampleEveryN != 0)
+	{
+		return false;
+	}
+
+	return State->NumCapturedThisMinute.fetch_add(1, std::memory_order_relaxed) < Policy.MaxPerMinute;
+}
+
+void FECCallstackSampler::Capture(const FECResult& Result)
+{
+	for (FSlot& Slot : Slots)
+	{
+		ESlotState Expected = ESlotState::Free;
+		if (!Slot.State.compare_exchange_strong(Expected, ESlotState::Writing, std::memory_order_acquire))
+		{
+			continue;
+		}
+
+		Slot.Result = Result;
+		Slot.ThreadId = FPlatformTLS::GetCurrentThreadId();
+		Slot.NumFrames = FPlatformStackWalk::CaptureStackBackTrace(Slot.Frames, MaxDepth);
+		Slot.State.store(ESlotState::Ready, std::memory_order_release);
+		return;
+	}
+
+	// Every slot is waiting for symbolication; dropping is preferable to allocating on the failure path.
+	NumDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool FECCallstackSampler::Tick(float DeltaTime)
+{
+	if (PendingSymbolication.IsValid() && !PendingSymbolication.IsCompleted())
+	{
+		return true;
+	}
+
+	const uint32 Dropped = NumDropped.exchange(0, std::memory_order_relaxed);
+	if (Dropped > 0)
+	{
+		UE_LOG(LogErrorHandling, Log, TEXT("Dropped %u sampled callstacks because the capture pool was full."), Dropped);
+	}
+
+	bool bHasReadySlots = false;
+	for (const FSlot& Slot : Slots)
+	{
+		bHasReadySlots |= Slot.State.load(std::memory_order_relaxed) == ESlotState::Ready;
+	}
+	if (!bHasReadySlots)
+	{
+		return true;
+	}
+
+	const bool bSymbolicate = Mgnc::Detail::CVarCallstacksSymbolicate.GetValueOnGameThread();
+	PendingSymbolication = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, bSymbolicate]()
+	{
+		for (FSlot& Slot : Slots)
+		{
+			ESlotState Expected = ESlotState::Ready;
+			if (!Slot.State.compare_exchange_strong(Expected, ESlotState::Symbolicating, std::memory_order_acquire))
+			{
+				continue;
+			}
+
+			LogSlot(Slot, bSymbolicate);
+			Slot.State.store(ESlotState::Free, std::memory_order_release);
+		}
+	}, UE::Tasks::ETaskPriority::BackgroundLow);
+
+	return true;
+}
+
+void FECCallstackSampler::LogSlot(const FSlot& Slot, bool bSymbolicate)
+{
+	FString Callstack;
+	bool bRefreshedModules = false;
+	for (uint32 Depth = 0; Depth < Slot.NumFrames; ++Depth)
+	{
+		if (bSymbolicate)
+		{
+			ANSICHAR Line[1024];
+			Line[0] = '\0';
+			FPlatformStackWalk::ProgramCounterToHumanReadableString(Depth, Slot.Frames[Depth], Line, sizeof(Line));
+			Callstack += FString::Printf(TEXT("\n\t%s"), ANSI_TO_TCHAR(Line));
+		}
+		else if (const FModuleRange* Module = FindModule(Slot.Frames[Depth], bRefreshedModules))
+		{
+			// Offsets stay valid under ASLR, unlike absolute addresses.
+			Callstack += FString::Printf(TEXT("\n\t%s+0x%llx"), *Module->Name, Slot.Frames[Depth] - Module->BaseAddress);
+		}
+		else
+		{
+			Callstack += FString::Printf(TEXT("\n\t0x%016llx"), Slot.Frames[Depth]);
+		}
+	}
+
+	const FString Message = FString::Printf(TEXT("Sampled callstack for '%s' (thread %u):%s"),
+		*Slot.Result.ToShortString(), Slot.ThreadId, *Callstack);
+	UE_LOG(LogErrorHandling, Warning, TEXT("%s"), *Message);
+	WriteToFile(Message);
+}
+
+void FECCallstackSampler::WriteToFile(const FString& Text)
+{
+	// UE_LOG is compiled out in Shipping, so callstacks also go to their own file.
+	if (!CallstackFile)
+	{
+		const FString Filename = FPaths::ProjectLogDir() / TEXT("ErrorHandlingCallstacks.log");
+		CallstackFile.Reset(IFileManager::Get().CreateFileWriter(*Filename, FILEWRITE_Append | FILEWRITE_AllowRead));
+		if (!CallstackFile)
+		{
+			return;
+		}
+	}
+
+	const FString Line = FString::Printf(TEXT("[%s] %s%s"), *FDateTime::UtcNow().ToString(), *Text, LINE_TERMINATOR);
+	const FTCHARToUTF8 Utf8(*Line);
+	CallstackFile->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	CallstackFile->Flush();
+}
+
+const FECCallstackSampler::FModuleRange* FECCallstackSampler::FindModule(uint64 ProgramCounter, bool& bRefreshed)
+{
+	auto Find = [this, ProgramCounter]() -> const FModuleRange*
+	{
+		return Modules.FindByPredicate([ProgramCounter](const FModuleRange& Module)
+		{
+			return ProgramCounter >= Module.BaseAddress && ProgramCounter - Module.BaseAddress < Module.Size;
+		});
+	};
+
+	const FModuleRange* Module = Find();
+	if (!Module && !bRefreshed)
+	{
+		// Modules may have been loaded since the last refresh.
+		bRefreshed = true;
+		RefreshModules();
+		Module = Find();
+	}
+	return Module;
+}
+
+void FECCallstackSampler::RefreshModules()
+{
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	Modules.Reset();
+
+	const int32 NumModules = FPlatformStackWalk::GetProcessModuleCount();
+	if (NumModules <= 0)
+	{
+		return;
+	}
+
+	TArray<FStackWalkModuleInfo> ModuleInfos;
+	ModuleInfos.SetNumZeroed(NumModules);
+	const int32 NumFound = FPlatformStackWalk::GetProcessModuleSignatures(ModuleInfos.GetData(), NumModules);
+
+	for (int32 ModuleIdx = 0; ModuleIdx < NumFound; ++ModuleIdx)
+	{
+		const FStackWalkModuleInfo& Info = ModuleInfos[ModuleIdx];
+		FModuleRange& Module = Modules.AddDefaulted_GetRef();
+		Module.BaseAddress = Info.BaseOfImage;
+		Module.Size = Info.ImageSize;
+		Module.Name = Info.ModuleName;
+	}
+}
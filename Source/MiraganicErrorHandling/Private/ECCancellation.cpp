@@ -0,0 +1,38 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECCancellation.h"
+
+FECCancellationToken FECCancellationToken::Create()
+{
+	FECCancellationToken Token;
+	Token.State = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+	return Token;
+}
+
+void FECCancellationToken::Cancel() const
+{
+	if (ensureMsgf(State.IsValid(), TEXT("Only tokens made with FECCancellationToken::Create can be cancelled.")))
+	{
+		State->store(true, std::memory_order_relaxed);
+	}
+}
+
+FECDeadline FECDeadline::After(double Seconds)
+{
+	FECDeadline Deadline;
+	Deadline.EndSeconds = FPlatformTime::Seconds() + Seconds;
+	return Deadline;
+}
+
+double FECDeadline::GetRemainingSeconds() const
+{
+	if (EndSeconds == TNumericLimits<double>::Max())
+	{
+		return TNumericLimits<double>::Max();
+	}
+	return FMath::Max(EndSeconds - FPlatformTime::Seconds(), 0.0);
+}
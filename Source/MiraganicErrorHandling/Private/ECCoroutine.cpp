@@ -0,0 +1,65 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECCoroutine.h"
+
+#include "Containers/LockFreeFixedSizeAllocator.h"
+#include "ECStats.h"
+
+namespace Mgnc::Detail
+{
+// Freed frames are kept for reuse by later coroutines of the same size class.
+static TLockFreeFixedSizeAllocator<256, PLATFORM_CACHE_LINE_SIZE> CoroutineFramePool256;
+static TLockFreeFixedSizeAllocator<512, PLATFORM_CACHE_LINE_SIZE> CoroutineFramePool512;
+static TLockFreeFixedSizeAllocator<1024, PLATFORM_CACHE_LINE_SIZE> CoroutineFramePool1024;
+static TLockFreeFixedSizeAllocator<2048, PLATFORM_CACHE_LINE_SIZE> CoroutineFramePool2048;
+} // namespace Mgnc::Detail
+
+void* Mgnc::Detail::AllocateCoroutineFrame(SIZE_T Size)
+{
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	if (Size <= 256)
+	{
+		return CoroutineFramePool256.Allocate();
+	}
+	if (Size <= 512)
+	{
+		return CoroutineFramePool512.Allocate();
+	}
+	if (Size <= 1024)
+	{
+		return CoroutineFramePool1024.Allocate();
+	}
+	if (Size <= 2048)
+	{
+		return CoroutineFramePool2048.Allocate();
+	}
+	return FMemory::Malloc(Size);
+}
+
+void Mgnc::Detail::FreeCoroutineFrame(void* Frame, SIZE_T Size)
+{
+	if (Size <= 256)
+	{
+		CoroutineFramePool256.Free(Frame);
+	}
+	else if (Size <= 512)
+	{
+		CoroutineFramePool512.Free(Frame);
+	}
+	else if (Size <= 1024)
+	{
+		CoroutineFramePool1024.Free(Frame);
+	}
+	else if (Size <= 2048)
+	{
+		CoroutineFramePool2048.Free(Frame);
+	}
+	else
+	{
+		FMemory::Free(Frame);
+	}
+}
@@ -7,10 +7,12 @@
 #include "ECErrorCategory.h"
 
 #include "ECLogging.h"
+#include "ECStats.h"
 #include "Internationalization/TextPackageNamespaceUtil.h"
 
 void UECErrorCategory::Serialize(FArchive& Ar)
 {
+	LLM_SCOPE_BYTAG(ErrorHandling);
 	UEnum::Serialize(Ar);
 
 	// UserDefinedEnum override modifies the values
@@ -41,6 +43,7 @@ void UECErrorCategory::PostDuplicate(bool bDuplicateForPIE)
 
 void UECErrorCategory::PostLoad()
 {
+	LLM_SCOPE_BYTAG(ErrorHandling);
 	UEnum::PostLoad();
 
 	UpdateAfterPathChanged();
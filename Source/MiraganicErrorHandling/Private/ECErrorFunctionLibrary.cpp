@@ -6,17 +6,24 @@
 #include "ECErrorFunctionLibrary.h"
 
 #include "ECErrorMacros.h"
+#include "ECFailureReporting.h"
 #include "ECLogging.h"
+#include "ECResultSwitchBinding.h"
+#include "ECStats.h"
 #include "Logging/MessageLog.h"
 #include "Misc/RuntimeErrors.h"
 
-FECResult UECErrorFunctionLibrary::MakeResult(FECResult Result)
+FECResult UECErrorFunctionLibrary::MakeResult(const FECResult& Result)
 {
 	return Result;
 }
 
-void UECErrorFunctionLibrary::LogResultToOutputLog(EECLogVerbosity Verbosity, FECResult Result)
+void UECErrorFunctionLibrary::LogResultToOutputLog(EECLogVerbosity Verbosity, const FECResult& Result)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ECLogResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult);
+
+	Mgnc::ReportFailure(Result);
 	switch (Verbosity)
 	{
 		default:
@@ -32,8 +39,12 @@ void UECErrorFunctionLibrary::LogResultToOutputLog(EECLogVerbosity Verbosity, FE
 	}
 }
 
-void UECErrorFunctionLibrary::LogResultToMessageLog(EECLogVerbosity Verbosity, FECResult Result)
+void UECErrorFunctionLibrary::LogResultToMessageLog(EECLogVerbosity Verbosity, const FECResult& Result)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ECLogResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult);
+
+	Mgnc::ReportFailure(Result);
 	FMessageLog MessageLog("PIE");
 	switch (Verbosity)
 	{
@@ -50,7 +61,7 @@ void UECErrorFunctionLibrary::LogResultToMessageLog(EECLogVerbosity Verbosity, F
 	}
 }
 
-void UECErrorFunctionLibrary::LogResultToOutputLogIfFailure(EECLogVerbosity Verbosity, FECResult Result)
+void UECErrorFunctionLibrary::LogResultToOutputLogIfFailure(EECLogVerbosity Verbosity, const FECResult& Result)
 {
 	if (Result.IsSuccess())
 	{
@@ -60,7 +71,7 @@ void UECErrorFunctionLibrary::LogResultToOutputLogIfFailure(EECLogVerbosity Verb
 	LogResultToOutputLog(Verbosity, Result);
 }
 
-void UECErrorFunctionLibrary::LogResultToMessageLogIfFailure(EECLogVerbosity Verbosity, FECResult Result)
+void UECErrorFunctionLibrary::LogResultToMessageLogIfFailure(EECLogVerbosity Verbosity, const FECResult& Result)
 {
 	if (Result.IsSuccess())
 	{
@@ -70,52 +81,219 @@ void UECErrorFunctionLibrary::LogResultToMessageLogIfFailure(EECLogVerbosity Ver
 	LogResultToMessageLog(Verbosity, Result);
 }
 
-bool UECErrorFunctionLibrary::Equal_ResultResult(FECResult A, FECResult B)
+namespace Mgnc::Detail
+{
+static void LogFailureCount(EECLogVerbosity Verbosity, const FECResult& Result, int32 Count)
+{
+	const FString Message = Count > 1 ? FString::Printf(TEXT("%s (x%d)"), *Result.ToString(), Count) : Result.ToString();
+	switch (Verbosity)
+	{
+		default:
+		case EECLogVerbosity::Normal:
+			UE_LOG(LogErrorHandling, Display, TEXT("%s"), *Message);
+			return;
+		case EECLogVerbosity::Warning:
+			UE_LOG(LogErrorHandling, Warning, TEXT("%s"), *Message);
+			return;
+		case EECLogVerbosity::Error:
+			UE_LOG(LogErrorHandling, Error, TEXT("%s"), *Message);
+			return;
+	}
+}
+} // namespace Mgnc::Detail
+
+int32 UECErrorFunctionLibrary::CountFailures(const TArray<FECResult>& Results)
+{
+	int32 NumFailures = 0;
+	for (const FECResult& Result : Results)
+	{
+		NumFailures += Result.IsFailure() ? 1 : 0;
+	}
+	return NumFailures;
+}
+
+FECResult UECErrorFunctionLibrary::FirstFailure(const TArray<FECResult>& Results, int32& Index)
+{
+	Index = Results.IndexOfByPredicate([](const FECResult& Result) { return Result.IsFailure(); });
+	return Index != INDEX_NONE ? Results[Index] : FECResult::Success();
+}
+
+bool UECErrorFunctionLibrary::AllSucceeded(const TArray<FECResult>& Results)
+{
+	return !Results.ContainsByPredicate([](const FECResult& Result) { return Result.IsFailure(); });
+}
+
+TArray<FECResult> UECErrorFunctionLibrary::DistinctFailures(const TArray<FECResult>& Results)
+{
+	TArray<FECResult> Failures;
+	TSet<FECResult> Seen;
+	for (const FECResult& Result : Results)
+	{
+		if (Result.IsFailure() && !Seen.Contains(Result))
+		{
+			Seen.Add(Result);
+			Failures.Add(Result);
+		}
+	}
+	return Failures;
+}
+
+void UECErrorFunctionLibrary::LogFailures(EECLogVerbosity Verbosity, const TArray<FECResult>& Results, bool bDeduplicate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ECLogResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult);
+
+	if (!bDeduplicate)
+	{
+		for (const FECResult& Result : Results)
+		{
+			if (Result.IsFailure())
+			{
+				Mgnc::ReportFailure(Result);
+				Mgnc::Detail::LogFailureCount(Verbosity, Result, 1);
+			}
+		}
+		return;
+	}
+
+	// Count each distinct failure, keeping the order of first occurrence.
+	TArray<TPair<FECResult, int32>> Counts;
+	TMap<FECResult, int32> CountIndices;
+	for (const FECResult& Result : Results)
+	{
+		if (Result.IsFailure())
+		{
+			Mgnc::ReportFailure(Result);
+			const int32 CountIndex = CountIndices.FindOrAdd(Result, Counts.Num());
+			if (CountIndex == Counts.Num())
+			{
+				Counts.Emplace(Result, 0);
+			}
+			++Counts[CountIndex].Value;
+		}
+	}
+
+	for (const TPair<FECResult, int32>& Count : Counts)
+	{
+		Mgnc::Detail::LogFailureCount(Verbosity, Count.Key, Count.Value);
+	}
+}
+
+FECPackedResults UECErrorFunctionLibrary::PackResults(const TArray<FECResult>& Results)
+{
+	FECPackedResults Packed;
+	Packed.Reserve(Results.Num());
+	for (const FECResult& Result : Results)
+	{
+		Packed.Add(Result);
+	}
+	return Packed;
+}
+
+int32 UECErrorFunctionLibrary::CountFailures_Packed(const FECPackedResults& Results)
+{
+	return Results.CountFailures();
+}
+
+FECResult UECErrorFunctionLibrary::FirstFailure_Packed(const FECPackedResults& Results, int32& Index)
+{
+	Index = Results.FindFirstFailure();
+	return Index != INDEX_NONE ? Results[Index] : FECResult::Success();
+}
+
+bool UECErrorFunctionLibrary::AllSucceeded_Packed(const FECPackedResults& Results)
+{
+	return Results.AllSucceeded();
+}
+
+TArray<FECResult> UECErrorFunctionLibrary::DistinctFailures_Packed(const FECPackedResults& Results)
+{
+	return Results.GetDistinctFailures();
+}
+
+void UECErrorFunctionLibrary::LogFailures_Packed(EECLogVerbosity Verbosity, const FECPackedResults& Results, bool bDeduplicate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ECLogResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult);
+
+	const TArray<FECResult>& Table = Results.GetTable();
+	if (!bDeduplicate)
+	{
+		for (const uint16 TableIndex : Results.GetIndices())
+		{
+			if (TableIndex != 0)
+			{
+				Mgnc::ReportFailure(Table[TableIndex]);
+				Mgnc::Detail::LogFailureCount(Verbosity, Table[TableIndex], 1);
+			}
+		}
+		return;
+	}
+
+	// The table is already deduplicated, so only a histogram of the indices is needed.
+	TArray<int32> Counts;
+	Counts.SetNumZeroed(Table.Num());
+	for (const uint16 TableIndex : Results.GetIndices())
+	{
+		++Counts[TableIndex];
+	}
+
+	for (int32 TableIndex = 1; TableIndex < Table.Num(); ++TableIndex)
+	{
+		for (int32 Occurrence = 0; Occurrence < Counts[TableIndex]; ++Occurrence)
+		{
+			Mgnc::ReportFailure(Table[TableIndex]);
+		}
+		Mgnc::Detail::LogFailureCount(Verbosity, Table[TableIndex], Counts[TableIndex]);
+	}
+}
+
+bool UECErrorFunctionLibrary::Equal_ResultResult(const FECResult& A, const FECResult& B)
 {
 	return A == B;
 }
 
-bool UECErrorFunctionLibrary::NotEqual_ResultResult(FECResult A, FECResult B)
+bool UECErrorFunctionLibrary::NotEqual_ResultResult(const FECResult& A, const FECResult& B)
 {
 	return A != B;
 }
 
-FText UECErrorFunctionLibrary::GetMessage(FECResult Result)
+FText UECErrorFunctionLibrary::GetMessage(const FECResult& Result)
 {
 	return Result.GetMessage();
 }
 
-FText UECErrorFunctionLibrary::GetTitle(FECResult Result)
+FText UECErrorFunctionLibrary::GetTitle(const FECResult& Result)
 {
 	return Result.GetTitle();
 }
 
-bool UECErrorFunctionLibrary::IsSuccess(FECResult Result)
+bool UECErrorFunctionLibrary::IsSuccess(const FECResult& Result)
 {
 	return Result.IsSuccess();
 }
 
-bool UECErrorFunctionLibrary::IsFailure(FECResult Result)
+bool UECErrorFunctionLibrary::IsFailure(const FECResult& Result)
 {
 	return Result.IsFailure();
 }
 
-bool UECErrorFunctionLibrary::HasValidError(FECResult Result)
+bool UECErrorFunctionLibrary::HasValidError(const FECResult& Result)
 {
 	return Result.HasValidError();
 }
 
-bool UECErrorFunctionLibrary::IsValid(FECResult Result)
+bool UECErrorFunctionLibrary::IsValid(const FECResult& Result)
 {
 	return Result.IsValid();
 }
 
-FString UECErrorFunctionLibrary::ToShortString(FECResult Result)
+FString UECErrorFunctionLibrary::ToShortString(const FECResult& Result)
 {
 	return Result.ToShortString();
 }
 
-FString UECErrorFunctionLibrary::Conv_ErrorCodeToString(FECResult Result)
+FString UECErrorFunctionLibrary::Conv_ErrorCodeToString(const FECResult& Result)
 {
 	return Result.ToString();
 }
@@ -131,5 +309,47 @@ FECResult UECErrorFunctionLibrary::EnumToResult(const UEnum* Enum, uint8 EnumVal
 		return FECResult::Success();
 	}
 	
-	return FECResult::ConstructRaw(Enum, static_cast<int64>(EnumValue));
+	return FECResult::ConstructRaw(Enum, EnumValue);
+}
+
+namespace Mgnc::Detail
+{
+// Find the output for a compiled switch or select. Native thunks run on the calling function's frame, and the case table
+// is baked into the class which owns that function, so the object's class hierarchy is never searched.
+static int32 FindSwitchOutputIndex(const FFrame& Stack, const FECResult& Selection, int32 TableKey, int32 DefaultIndex)
+{
+	const UClass* OwnerClass = Stack.Node ? Stack.Node->GetOwnerClass() : nullptr;
+	const FECResultSwitchTable* Table = UECResultSwitchBinding::FindTableForClass(OwnerClass, TableKey);
+	if (!Table)
+	{
+		UE_LOG(LogErrorHandling, Error, TEXT("%s: No case table found for '%s' in '%s'. Recompile the Blueprint."),
+			EC_FUNCNAME, *GetNameSafe(Stack.Node), *GetNameSafe(OwnerClass));
+		return DefaultIndex;
+	}
+
+	return Table->FindOutputIndex(Selection);
+}
+} // namespace Mgnc::Detail
+
+DEFINE_FUNCTION(UECErrorFunctionLibrary::execGetSwitchResultOutput)
+{
+	P_GET_STRUCT_REF(FECResult, Selection);
+	P_GET_PROPERTY(FIntProperty, TableKey);
+	P_GET_PROPERTY(FIntProperty, DefaultIndex);
+	P_FINISH;
+	P_NATIVE_BEGIN;
+	*static_cast<FECResultSwitchOutput*>(RESULT_PARAM) =
+		FECResultSwitchOutput(Mgnc::Detail::FindSwitchOutputIndex(Stack, Selection, TableKey, DefaultIndex));
+	P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(UECErrorFunctionLibrary::execGetSelectResultOptionIndex)
+{
+	P_GET_STRUCT_REF(FECResult, Selection);
+	P_GET_PROPERTY(FIntProperty, TableKey);
+	P_GET_PROPERTY(FIntProperty, DefaultIndex);
+	P_FINISH;
+	P_NATIVE_BEGIN;
+	*static_cast<int32*>(RESULT_PARAM) = Mgnc::Detail::FindSwitchOutputIndex(Stack, Selection, TableKey, DefaultIndex);
+	P_NATIVE_END;
 }
@@ -5,13 +5,27 @@
 
 #include "ECErrorHandlingModule.h"
 
+#include "ECCallstackSampler.h"
+#include "ECFrameFailureStats.h"
+#include "ECMetricsExporter.h"
+
 void FECErrorHandlingModule::StartupModule()
 {
+	MetricsExporter = MakeShared<FECMetricsExporter>();
+	MetricsExporter->Startup();
+	FECCallstackSampler::Get().Startup();
+	FECFrameFailureStats::Get().Startup();
 }
 
 void FECErrorHandlingModule::ShutdownModule()
 {
-    
+	FECFrameFailureStats::Get().Shutdown();
+	FECCallstackSampler::Get().Shutdown();
+	if (MetricsExporter.IsValid())
+	{
+		MetricsExporter->Shutdown();
+		MetricsExporter.Reset();
+	}
 }
     
-IMPLEMENT_MODULE(FECErrorHandlingModule, MiraganicErrorHandling)
\ No newline at end of file
+IMPLEMENT_MODULE(FECErrorHandlingModule, MiraganicErrorHandling)
@@ -5,3 +5,19 @@
 
 
 #include "ECErrorMacros.h"
+
+void Mgnc::Detail::LogValidationFailure(const TCHAR* FunctionName, const FECResult& Result)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ECLogResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult);
+	UE_LOG(LogErrorHandling, Error, TEXT("%s: %s"), FunctionName, *Result.ToString());
+	ReportFailure(Result);
+}
+
+void Mgnc::Detail::LogValidationFailure(const TCHAR* FunctionName, const FECResultWithArgs& Result)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ECLogResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult);
+	UE_LOG(LogErrorHandling, Error, TEXT("%s: %s"), FunctionName, *Result.ToString());
+	ReportFailure(Result);
+}
@@ -0,0 +1,163 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECFailureRateMonitor.h"
+
+#include "ECStats.h"
+
+FECFailureRateMonitor& FECFailureRateMonitor::Get()
+{
+	static FECFailureRateMonitor Monitor;
+	return Monitor;
+}
+
+int32 FECFailureRateMonitor::AddAlarm(const FECFailureRateAlarm& Alarm)
+{
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	FScopeLock ScopeLock(&Lock);
+	FWindow Window;
+	Window.Alarm = Alarm;
+	Window.BucketSeconds = FMath::Max(Alarm.WindowSeconds, 0.1f) / NumBuckets;
+	Window.HeadBucket = static_cast<int64>(FPlatformTime::Seconds() / Window.BucketSeconds);
+	const int32 AlarmId = NextAlarmId++;
+	Windows.Add(AlarmId, MoveTemp(Window));
+	NumAlarms.store(Windows.Num(), std::memory_order_relaxed);
+
+	if (Alarm.bMatchWholeCategory)
+	{
+		CategoryAlarms.Add(Alarm.Result.GetCategory(), AlarmId);
+	}
+	else
+	{
+		ResultAlarms.Add(Alarm.Result, AlarmId);
+	}
+
+	return AlarmId;
+}
+
+void FECFailureRateMonitor::RemoveAlarm(int32 AlarmId)
+{
+	FScopeLock ScopeLock(&Lock);
+	const FWindow* Window = Windows.Find(AlarmId);
+	if (!Window)
+	{
+		return;
+	}
+
+	const FECFailureRateAlarm& Alarm = Window->Alarm;
+	if (Alarm.bMatchWholeCategory)
+	{
+		CategoryAlarms.RemoveSingle(Alarm.Result.GetCategory(), AlarmId);
+	}
+	else
+	{
+		ResultAlarms.RemoveSingle(Alarm.Result, AlarmId);
+	}
+	Windows.Remove(AlarmId);
+	NumAlarms.store(Windows.Num(), std::memory_order_relaxed);
+}
+
+void FECFailureRateMonitor::RemoveAllAlarms()
+{
+	FScopeLock ScopeLock(&Lock);
+	Windows.Empty();
+	ResultAlarms.Empty();
+	CategoryAlarms.Empty();
+	NumAlarms.store(0, std::memory_order_relaxed);
+}
+
+void FECFailureRateMonitor::RecordFailure(const FECResult& Result)
+{
+	// Avoid taking the lock when nothing is being monitored.
+	if (NumAlarms.load(std::memory_order_relaxed) == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	auto RecordInWindow = [this, Now](int32 AlarmId)
+	{
+		FWindow& Window = Windows.FindChecked(AlarmId);
+		Window.Advance(Now);
+		++Window.Buckets[Window.HeadBucket % NumBuckets];
+		++Window.Sum;
+
+		if (!Window.bTriggered && Window.GetRate() > Window.Alarm.MaxFailuresPerSecond)
+		{
+			Window.bTriggered = true;
+			Window.bPendingEvent = true;
+		}
+	};
+
+	FScopeLock ScopeLock(&Lock);
+	for (auto It = ResultAlarms.CreateConstKeyIterator(Result); It; ++It)
+	{
+		RecordInWindow(It.Value());
+	}
+	for (auto It = CategoryAlarms.CreateConstKeyIterator(Result.GetCategory()); It; ++It)
+	{
+		RecordInWindow(It.Value());
+	}
+}
+
+void FECFailureRateMonitor::ConsumeEvents(TArray<FECFailureRateAlarmEvent>& OutEvents)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FScopeLock ScopeLock(&Lock);
+	for (auto It = Windows.CreateIterator(); It; ++It)
+	{
+		FWindow& Window = It.Value();
+		if (Window.bPendingEvent)
+		{
+			Window.bPendingEvent = false;
+			FECFailureRateAlarmEvent& Event = OutEvents.AddDefaulted_GetRef();
+			Event.AlarmId = It.Key();
+			Event.Alarm = Window.Alarm;
+			Event.FailuresPerSecond = Window.GetRate();
+		}
+		else if (Window.bTriggered)
+		{
+			Window.Advance(Now);
+			if (Window.GetRate() <= Window.Alarm.MaxFailuresPerSecond)
+			{
+				Window.bTriggered = false;
+			}
+		}
+	}
+}
+
+void FECFailureRateMonitor::FWindow::Advance(double Now)
+{
+	const int64 NewHead = static_cast<int64>(Now / BucketSeconds);
+	const int64 NumExpired = NewHead - HeadBucket;
+	if (NumExpired <= 0)
+	{
+		return;
+	}
+
+	if (NumExpired >= NumBuckets)
+	{
+		FMemory::Memzero(Buckets);
+		Sum = 0;
+	}
+	else
+	{
+		for (int64 Bucket = HeadBucket + 1; Bucket <= NewHead; ++Bucket)
+		{
+			int32& Count = Buckets[Bucket % NumBuckets];
+			Sum -= Count;
+			Count = 0;
+		}
+	}
+	HeadBucket = NewHead;
+}
+
+float FECFailureRateMonitor::FWindow::GetRate() const
+{
+	return static_cast<float>(Sum / (BucketSeconds * NumBuckets));
+}
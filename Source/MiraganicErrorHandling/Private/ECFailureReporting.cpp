@@ -0,0 +1,98 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECFailureReporting.h"
+
+#include "ECCallstackSampler.h"
+#include "ECFailureRateMonitor.h"
+#include "ECFrameFailureStats.h"
+#include "ECStats.h"
+#include "Misc/ScopeRWLock.h"
+
+FECFailureCounters& FECFailureCounters::Get()
+{
+	static FECFailureCounters Counters;
+	return Counters;
+}
+
+void FECFailureCounters::Increment(const FECResult& Result)
+{
+	if (Result.IsSuccess())
+	{
+		return;
+	}
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const TUniquePtr<FCounter>* Counter = Counters.Find(Result))
+		{
+			(*Counter)->Count.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+	}
+
+	// First failure for this result; resolve its names once so snapshots never need to touch the category.
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	FWriteScopeLock WriteLock(Lock);
+	TUniquePtr<FCounter>& Counter = Counters.FindOrAdd(Result);
+	if (!Counter)
+	{
+		Counter = MakeUnique<FCounter>();
+		if (Result.HasValidError())
+		{
+			Counter->CategoryName = Result.GetCategory()->GetName();
+			Counter->CodeName = Result.GetCategory()->GetAuthoredNameStringByValue(Result.GetValue());
+		}
+		else
+		{
+			Counter->CategoryName = TEXT("Invalid");
+			Counter->CodeName = FString::Printf(TEXT("%lld"), Result.GetValue());
+		}
+	}
+	Counter->Count.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64 FECFailureCounters::GetCount(const FECResult& Result) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const TUniquePtr<FCounter>* Counter = Counters.Find(Result);
+	return Counter ? (*Counter)->Count.load(std::memory_order_relaxed) : 0;
+}
+
+void FECFailureCounters::Snapshot(TArray<FECFailureCountSnapshot>& OutCounts) const
+{
+	FReadScopeLock ReadLock(Lock);
+	OutCounts.Reserve(OutCounts.Num() + Counters.Num());
+	for (const TPair<FECResult, TUniquePtr<FCounter>>& Pair : Counters)
+	{
+		FECFailureCountSnapshot& Snapshot = OutCounts.AddDefaulted_GetRef();
+		Snapshot.CategoryName = Pair.Value->CategoryName;
+		Snapshot.CodeName = Pair.Value->CodeName;
+		Snapshot.Count = Pair.Value->Count.load(std::memory_order_relaxed);
+	}
+}
+
+void FECFailureCounters::Reset()
+{
+	FReadScopeLock ReadLock(Lock);
+	for (const TPair<FECResult, TUniquePtr<FCounter>>& Pair : Counters)
+	{
+		Pair.Value->Count.store(0, std::memory_order_relaxed);
+	}
+}
+
+void Mgnc::ReportFailure(const FECResult& Result)
+{
+	if (Result.IsSuccess())
+	{
+		return;
+	}
+
+	FECFailureCounters::Get().Increment(Result);
+	FECFailureRateMonitor::Get().RecordFailure(Result);
+	FECCallstackSampler::Get().SampleFailure(Result);
+	FECFrameFailureStats::Get().RecordFailure(Result);
+}
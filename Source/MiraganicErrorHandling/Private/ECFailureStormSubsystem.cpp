@@ -0,0 +1,83 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECFailureStormSubsystem.h"
+
+#include "ECLogging.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+void UECFailureStormSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	for (const FECFailureRateAlarm& Alarm : Alarms)
+	{
+		AddAlarm(Alarm);
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UECFailureStormSubsystem::Tick));
+}
+
+void UECFailureStormSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	// The monitor outlives the subsystem, so remove every alarm it added, including those added at runtime.
+	for (const int32 AlarmId : AlarmIds)
+	{
+		FECFailureRateMonitor::Get().RemoveAlarm(AlarmId);
+	}
+	AlarmIds.Reset();
+
+	Super::Deinitialize();
+}
+
+int32 UECFailureStormSubsystem::AddAlarm(const FECFailureRateAlarm& Alarm)
+{
+	const int32 AlarmId = FECFailureRateMonitor::Get().AddAlarm(Alarm);
+	AlarmIds.Add(AlarmId);
+	return AlarmId;
+}
+
+void UECFailureStormSubsystem::RemoveAlarm(int32 AlarmId)
+{
+	AlarmIds.Remove(AlarmId);
+	FECFailureRateMonitor::Get().RemoveAlarm(AlarmId);
+}
+
+bool UECFailureStormSubsystem::Tick(float DeltaTime)
+{
+	TArray<FECFailureRateAlarmEvent> Events;
+	FECFailureRateMonitor::Get().ConsumeEvents(Events);
+
+	for (const FECFailureRateAlarmEvent& Event : Events)
+	{
+		const FString ResultName = Event.Alarm.bMatchWholeCategory
+			? GetNameSafe(Event.Alarm.Result.GetCategory())
+			: Event.Alarm.Result.ToShortString();
+		UE_LOG(LogErrorHandling, Warning, TEXT("Failure storm: '%s' is failing %.1f times per second (limit %.1f)."),
+			*ResultName, Event.FailuresPerSecond, Event.Alarm.MaxFailuresPerSecond);
+
+#if CSV_PROFILER
+		if (Event.Alarm.bEmitCsvEvent)
+		{
+			CSV_EVENT_GLOBAL(TEXT("FailureStorm: %s"), *ResultName);
+		}
+#endif
+		if (Event.Alarm.bEmitTraceBookmark)
+		{
+			TRACE_BOOKMARK(TEXT("FailureStorm: %s"), *ResultName);
+		}
+
+		OnFailureStormNative.Broadcast(Event.Alarm, Event.FailuresPerSecond);
+		OnFailureStorm.Broadcast(Event.Alarm, Event.FailuresPerSecond);
+	}
+
+	return true;
+}
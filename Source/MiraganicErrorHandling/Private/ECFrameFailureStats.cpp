@@ -0,0 +1,123 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECFrameFailureStats.h"
+
+#include "Algo/Sort.h"
+#include "ECStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+
+namespace Mgnc::Detail
+{
+static TAutoConsoleVariable<int32> CVarCsvTopCodes(
+	TEXT("ec.Csv.TopCodes"),
+	0,
+	TEXT("Number of most frequent failing codes to record per frame in the ErrorHandling CSV category. 0 records only per-category counts."),
+	ECVF_Default);
+} // namespace Mgnc::Detail
+
+FECFrameFailureStats& FECFrameFailureStats::Get()
+{
+	static FECFrameFailureStats Stats;
+	return Stats;
+}
+
+void FECFrameFailureStats::Startup()
+{
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FECFrameFailureStats::OnEndFrame);
+}
+
+void FECFrameFailureStats::Shutdown()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+}
+
+void FECFrameFailureStats::RecordFailure(const FECResult& Result)
+{
+	INC_DWORD_STAT(STAT_ECFailuresReported);
+
+#if CSV_PROFILER
+	FCsvProfiler* CsvProfiler = FCsvProfiler::Get();
+	if (!CsvProfiler->IsCapturing() || !CsvProfiler->IsCategoryEnabled(CSV_CATEGORY_INDEX(ErrorHandling)))
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	FScopeLock ScopeLock(&Lock);
+	++TotalCount;
+
+	FCategoryCount& CategoryCount = CategoryCounts.FindOrAdd(Result.GetCategory());
+	if (CategoryCount.StatName.IsNone())
+	{
+		CategoryCount.StatName = Result.GetCategory() ? Result.GetCategory()->GetFName() : FName(TEXT("Invalid"));
+	}
+	++CategoryCount.Count;
+
+	if (Mgnc::Detail::CVarCsvTopCodes.GetValueOnAnyThread() > 0)
+	{
+		FCodeCount& CodeCount = CodeCounts.FindOrAdd(Result);
+		if (CodeCount.StatName.IsNone())
+		{
+			CodeCount.StatName = FName(FString::Printf(TEXT("%s.%s"), *CategoryCount.StatName.ToString(),
+				Result.HasValidError()
+					? *Result.GetCategory()->GetAuthoredNameStringByValue(Result.GetValue())
+					: *LexToString(Result.GetValue())));
+		}
+		++CodeCount.Count;
+	}
+#endif
+}
+
+void FECFrameFailureStats::OnEndFrame()
+{
+#if CSV_PROFILER
+	FCsvProfiler* CsvProfiler = FCsvProfiler::Get();
+	if (!CsvProfiler->IsCapturing())
+	{
+		return;
+	}
+
+	const int32 CategoryIndex = CSV_CATEGORY_INDEX(ErrorHandling);
+
+	FScopeLock ScopeLock(&Lock);
+	CSV_CUSTOM_STAT(ErrorHandling, Failures, TotalCount, ECsvCustomStatOp::Set);
+	TotalCount = 0;
+
+	// Record every category seen during the capture, so frames without failures show as zero rather than missing.
+	for (TPair<const UEnum*, FCategoryCount>& Pair : CategoryCounts)
+	{
+		CsvProfiler->RecordCustomStat(Pair.Value.StatName, CategoryIndex, Pair.Value.Count, ECsvCustomStatOp::Set);
+		Pair.Value.Count = 0;
+	}
+
+	const int32 NumTopCodes = Mgnc::Detail::CVarCsvTopCodes.GetValueOnGameThread();
+	if (NumTopCodes > 0 && CodeCounts.Num() > 0)
+	{
+		TArray<FCodeCount*, TInlineAllocator<32>> FailedCodes;
+		for (TPair<FECResult, FCodeCount>& Pair : CodeCounts)
+		{
+			if (Pair.Value.Count > 0)
+			{
+				FailedCodes.Add(&Pair.Value);
+			}
+		}
+
+		Algo::Sort(FailedCodes, [](const FCodeCount* A, const FCodeCount* B) { return A->Count > B->Count; });
+		for (int32 Idx = 0; Idx < FMath::Min(NumTopCodes, FailedCodes.Num()); ++Idx)
+		{
+			CsvProfiler->RecordCustomStat(FailedCodes[Idx]->StatName, CategoryIndex, FailedCodes[Idx]->Count,
+				ECsvCustomStatOp::Set);
+		}
+		for (FCodeCount* CodeCount : FailedCodes)
+		{
+			CodeCount->Count = 0;
+		}
+	}
+#endif
+}
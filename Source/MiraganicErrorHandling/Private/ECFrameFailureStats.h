@@ -0,0 +1,46 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+
+/**
+ * Records per-frame failure counts per category in the 'ErrorHandling' CSV category, plus the most frequent codes
+ * when 'ec.Csv.TopCodes' is set. Only collects while a CSV capture is running.
+ */
+class FECFrameFailureStats
+{
+public:
+	static FECFrameFailureStats& Get();
+
+	void Startup();
+	void Shutdown();
+
+	void RecordFailure(const FECResult& Result);
+
+private:
+	void OnEndFrame();
+
+	struct FCategoryCount
+	{
+		FName StatName;
+		int32 Count = 0;
+	};
+
+	struct FCodeCount
+	{
+		FName StatName;
+		int32 Count = 0;
+	};
+
+	FCriticalSection Lock;
+	// Entries are kept between frames so stat names are only built once per category and code.
+	TMap<const UEnum*, FCategoryCount> CategoryCounts;
+	TMap<FECResult, FCodeCount> CodeCounts;
+	int32 TotalCount = 0;
+	FDelegateHandle EndFrameHandle;
+};
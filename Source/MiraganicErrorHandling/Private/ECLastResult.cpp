@@ -0,0 +1,40 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECLastResult.h"
+
+namespace Mgnc::Detail
+{
+// Stored as raw fields rather than an FECResult, so the slot is trivially constructible and needs no TLS guard.
+static thread_local const UEnum* LastResultCategory = nullptr;
+static thread_local int64 LastResultValue = 0;
+static thread_local bool bHasLastResult = false;
+} // namespace Mgnc::Detail
+
+void Mgnc::SetLastResult(const FECResult& Result)
+{
+	Detail::LastResultCategory = Result.GetCategory();
+	Detail::LastResultValue = Result.GetValue();
+	Detail::bHasLastResult = true;
+}
+
+FECResult Mgnc::ConsumeLastResult(const FECResult& Fallback)
+{
+	if (!Detail::bHasLastResult)
+	{
+		return Fallback;
+	}
+
+	Detail::bHasLastResult = false;
+	const FECResult Result = FECResult::ConstructRaw(Detail::LastResultCategory, Detail::LastResultValue);
+	// A stored 'Success' doesn't explain a failure (E.g., a nested callee succeeded), so treat it as absent.
+	return Result.IsFailure() ? Result : Fallback;
+}
+
+void Mgnc::ResetLastResult()
+{
+	Detail::bHasLastResult = false;
+}
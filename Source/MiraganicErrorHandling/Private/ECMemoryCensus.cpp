@@ -0,0 +1,177 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "CoreMinimal.h"
+#include "ECErrorCategory.h"
+#include "ECResult.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+
+namespace Mgnc::Detail
+{
+struct FResultCensusEntry
+{
+	int32 NumObjects = 0;
+	int64 NumResults = 0;
+	int64 NumBytes = 0;
+};
+
+static void CountResultsInProperty(const FProperty* Property, const void* ContainerPtr, int64& OutNumResults, int64& OutNumBytes);
+
+// Only structs and containers can hold results, so elements of other types aren't visited.
+static bool CanContainResults(const FProperty* Property)
+{
+	return Property->IsA<FStructProperty>() || Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>()
+		|| Property->IsA<FMapProperty>();
+}
+
+// Count FECResult values in one value of a property, recursing into structs and containers. Bytes are the results'
+// own size; container overhead isn't counted.
+static void CountResultsInValue(const FProperty* Property, const void* ValuePtr, int64& OutNumResults, int64& OutNumBytes)
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		if (StructProperty->Struct == FECResult::StaticStruct())
+		{
+			++OutNumResults;
+			OutNumBytes += StructProperty->ElementSize;
+			return;
+		}
+
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			CountResultsInProperty(*It, ValuePtr, OutNumResults, OutNumBytes);
+		}
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		if (!CanContainResults(ArrayProperty->Inner))
+		{
+			return;
+		}
+
+		FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		for (int32 Idx = 0; Idx < Helper.Num(); ++Idx)
+		{
+			CountResultsInValue(ArrayProperty->Inner, Helper.GetRawPtr(Idx), OutNumResults, OutNumBytes);
+		}
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		if (!CanContainResults(SetProperty->ElementProp))
+		{
+			return;
+		}
+
+		FScriptSetHelper Helper(SetProperty, ValuePtr);
+		for (int32 Idx = 0, NumRemaining = Helper.Num(); NumRemaining > 0; ++Idx)
+		{
+			if (Helper.IsValidIndex(Idx))
+			{
+				--NumRemaining;
+				CountResultsInValue(SetProperty->ElementProp, Helper.GetElementPtr(Idx), OutNumResults, OutNumBytes);
+			}
+		}
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		const bool bCountKeys = CanContainResults(MapProperty->KeyProp);
+		const bool bCountValues = CanContainResults(MapProperty->ValueProp);
+		if (!bCountKeys && !bCountValues)
+		{
+			return;
+		}
+
+		FScriptMapHelper Helper(MapProperty, ValuePtr);
+		for (int32 Idx = 0, NumRemaining = Helper.Num(); NumRemaining > 0; ++Idx)
+		{
+			if (!Helper.IsValidIndex(Idx))
+			{
+				continue;
+			}
+
+			--NumRemaining;
+			if (bCountKeys)
+			{
+				CountResultsInValue(MapProperty->KeyProp, Helper.GetKeyPtr(Idx), OutNumResults, OutNumBytes);
+			}
+			if (bCountValues)
+			{
+				CountResultsInValue(MapProperty->ValueProp, Helper.GetValuePtr(Idx), OutNumResults, OutNumBytes);
+			}
+		}
+	}
+}
+
+// Count FECResult values in a property of an object or struct, including each element of a static array.
+static void CountResultsInProperty(const FProperty* Property, const void* ContainerPtr, int64& OutNumResults, int64& OutNumBytes)
+{
+	if (!CanContainResults(Property))
+	{
+		return;
+	}
+
+	for (int32 Idx = 0; Idx < Property->ArrayDim; ++Idx)
+	{
+		CountResultsInValue(Property, Property->ContainerPtrToValuePtr<void>(ContainerPtr, Idx), OutNumResults, OutNumBytes);
+	}
+}
+
+static void ReportResultMemory(const TArray<FString>& Args, FOutputDevice& Ar)
+{
+	TMap<const UClass*, FResultCensusEntry> Entries;
+	for (TObjectIterator<UObject> It; It; ++It)
+	{
+		const UObject* Object = *It;
+		int64 NumResults = 0;
+		int64 NumBytes = 0;
+		for (TFieldIterator<FProperty> PropIt(Object->GetClass()); PropIt; ++PropIt)
+		{
+			CountResultsInProperty(*PropIt, Object, NumResults, NumBytes);
+		}
+
+		if (NumResults > 0)
+		{
+			FResultCensusEntry& Entry = Entries.FindOrAdd(Object->GetClass());
+			++Entry.NumObjects;
+			Entry.NumResults += NumResults;
+			Entry.NumBytes += NumBytes;
+		}
+	}
+
+	Entries.ValueSort([](const FResultCensusEntry& A, const FResultCensusEntry& B)
+	{
+		return A.NumBytes > B.NumBytes;
+	});
+
+	int64 TotalBytes = 0;
+	Ar.Logf(TEXT("FECResult memory by owning class (sizeof(FECResult) = %d):"), static_cast<int32>(sizeof(FECResult)));
+	Ar.Logf(TEXT("%12s %12s %10s  %s"), TEXT("Bytes"), TEXT("Results"), TEXT("Objects"), TEXT("Class"));
+	for (const TPair<const UClass*, FResultCensusEntry>& Pair : Entries)
+	{
+		Ar.Logf(TEXT("%12lld %12lld %10d  %s"), Pair.Value.NumBytes, Pair.Value.NumResults, Pair.Value.NumObjects,
+			*Pair.Key->GetPathName());
+		TotalBytes += Pair.Value.NumBytes;
+	}
+
+	int64 NumCategories = 0;
+	int64 DisplayNameBytes = 0;
+	for (TObjectIterator<UECErrorCategory> It; It; ++It)
+	{
+		++NumCategories;
+		DisplayNameBytes += It->DisplayNameMap.GetAllocatedSize();
+	}
+
+	Ar.Logf(TEXT("Total: %lld bytes in FECResult properties."), TotalBytes);
+	Ar.Logf(TEXT("Error categories: %lld, display name maps: %lld bytes."), NumCategories, DisplayNameBytes);
+}
+
+static FAutoConsoleCommandWithArgsAndOutputDevice CmdResultMemReport(
+	TEXT("ec.MemReport"),
+	TEXT("Report memory used by FECResult properties of loaded objects, grouped by owning class. Element sizes only; container slack is not included."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&ReportResultMemory));
+} // namespace Mgnc::Detail
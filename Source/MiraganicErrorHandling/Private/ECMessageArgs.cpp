@@ -0,0 +1,135 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECMessageArgs.h"
+
+#include "ECMessageFormat.h"
+
+#define LOCTEXT_NAMESPACE "ErrorHandling"
+
+static_assert(sizeof(FMinimalName) <= sizeof(uint64), "FMinimalName must fit in a message argument payload.");
+
+void FECMessageArgs::Add(FName Value)
+{
+	if (!CanAdd())
+	{
+		return;
+	}
+
+	const FMinimalName MinimalName = NameToMinimalName(Value);
+	Payloads[NumArgs] = 0;
+	FMemory::Memcpy(&Payloads[NumArgs], &MinimalName, sizeof(FMinimalName));
+	Types[NumArgs] = EType::Name;
+	++NumArgs;
+}
+
+void FECMessageArgs::AddInt(int64 Value)
+{
+	if (!CanAdd())
+	{
+		return;
+	}
+
+	FMemory::Memcpy(&Payloads[NumArgs], &Value, sizeof(int64));
+	Types[NumArgs] = EType::Int;
+	++NumArgs;
+}
+
+void FECMessageArgs::AddDouble(double Value)
+{
+	if (!CanAdd())
+	{
+		return;
+	}
+
+	FMemory::Memcpy(&Payloads[NumArgs], &Value, sizeof(double));
+	Types[NumArgs] = EType::Double;
+	++NumArgs;
+}
+
+bool FECMessageArgs::CanAdd() const
+{
+	return ensureMsgf(NumArgs < MaxArgs, TEXT("Results can carry at most %d message arguments."), MaxArgs);
+}
+
+void FECMessageArgs::ToFormatArgs(TArray<FStringFormatArg, TInlineAllocator<MaxArgs>>& OutArgs) const
+{
+	OutArgs.Reserve(NumArgs);
+	for (int32 Idx = 0; Idx < NumArgs; ++Idx)
+	{
+		switch (Types[Idx])
+		{
+			case EType::Int:
+			{
+				int64 Value;
+				FMemory::Memcpy(&Value, &Payloads[Idx], sizeof(int64));
+				OutArgs.Emplace(Value);
+				break;
+			}
+			case EType::Double:
+			{
+				double Value;
+				FMemory::Memcpy(&Value, &Payloads[Idx], sizeof(double));
+				OutArgs.Emplace(Value);
+				break;
+			}
+			case EType::Name:
+			{
+				FMinimalName Value;
+				FMemory::Memcpy(&Value, &Payloads[Idx], sizeof(FMinimalName));
+				OutArgs.Emplace(MinimalNameToName(Value).ToString());
+				break;
+			}
+			default:
+				checkNoEntry();
+		}
+	}
+}
+
+FText FECResultWithArgs::GetFormattedMessage() const
+{
+	if (Args.IsEmpty() || !Result.HasValidError())
+	{
+		return Result.GetFormattedMessage();
+	}
+
+	return FText::Format(LOCTEXT("ErrorCode_Msg_ErrorFmt", "{0}:{1}: {2}"),
+		{Result.GetCategoryName(), Result.GetTitle(), FText::FromString(FormatMessage())});
+}
+
+FText FECResultWithArgs::GetMessage() const
+{
+	if (Args.IsEmpty() || !Result.HasValidError())
+	{
+		return Result.GetMessage();
+	}
+
+	return FText::FromString(FormatMessage());
+}
+
+FString FECResultWithArgs::ToString() const
+{
+	if (Args.IsEmpty() || !Result.HasValidError())
+	{
+		return Result.ToString();
+	}
+
+	TStringBuilder<256> Builder;
+	Builder << Result.ToShortString() << TEXT(": ");
+	TArray<FStringFormatArg, TInlineAllocator<FECMessageArgs::MaxArgs>> FormatArgs;
+	Args.ToFormatArgs(FormatArgs);
+	Mgnc::AppendFormattedResultMessage(Builder, Result, FormatArgs);
+	return FString(Builder.ToView());
+}
+
+FString FECResultWithArgs::FormatMessage() const
+{
+	TArray<FStringFormatArg, TInlineAllocator<FECMessageArgs::MaxArgs>> FormatArgs;
+	Args.ToFormatArgs(FormatArgs);
+	return Mgnc::FormatResultMessage(Result, FormatArgs);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,186 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECMessageFormat.h"
+
+#include "ECErrorCategory.h"
+#include "ECStats.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/ScopeRWLock.h"
+
+FECCompiledMessageFormat FECCompiledMessageFormat::Compile(FStringView Pattern)
+{
+	FECCompiledMessageFormat Format;
+	Format.Literals.Reserve(Pattern.Len());
+
+	auto AppendLiteral = [&Format](FStringView Literal)
+	{
+		FSegment* LastSegment = Format.Segments.Num() > 0 ? &Format.Segments.Last() : nullptr;
+		if (!LastSegment || LastSegment->ArgIndex != INDEX_NONE)
+		{
+			LastSegment = &Format.Segments.AddDefaulted_GetRef();
+			LastSegment->LiteralStart = Format.Literals.Len();
+		}
+		Format.Literals.Append(Literal.GetData(), Literal.Len());
+		LastSegment->LiteralLen += Literal.Len();
+	};
+
+	int32 Idx = 0;
+	while (Idx < Pattern.Len())
+	{
+		const TCHAR Char = Pattern[Idx];
+		if (Char == TEXT('`') && Idx + 1 < Pattern.Len())
+		{
+			const TCHAR Next = Pattern[Idx + 1];
+			if (Next == TEXT('{') || Next == TEXT('}') || Next == TEXT('`'))
+			{
+				AppendLiteral(Pattern.Mid(Idx + 1, 1));
+				Idx += 2;
+				continue;
+			}
+		}
+
+		if (Char == TEXT('{'))
+		{
+			int32 CloseIdx = Idx + 1;
+			while (CloseIdx < Pattern.Len() && FChar::IsDigit(Pattern[CloseIdx]))
+			{
+				++CloseIdx;
+			}
+
+			if (CloseIdx > Idx + 1 && CloseIdx < Pattern.Len() && Pattern[CloseIdx] == TEXT('}'))
+			{
+				const FStringView Placeholder = Pattern.Mid(Idx, CloseIdx - Idx + 1);
+				FSegment& ArgSegment = Format.Segments.AddDefaulted_GetRef();
+				ArgSegment.ArgIndex = FCString::Atoi(*FString(Placeholder.Mid(1, Placeholder.Len() - 2)));
+				// Keep the placeholder text so out-of-range arguments can be written as-is.
+				ArgSegment.LiteralStart = Format.Literals.Len();
+				ArgSegment.LiteralLen = Placeholder.Len();
+				Format.Literals.Append(Placeholder.GetData(), Placeholder.Len());
+				Idx = CloseIdx + 1;
+				continue;
+			}
+		}
+
+		AppendLiteral(Pattern.Mid(Idx, 1));
+		++Idx;
+	}
+
+	return Format;
+}
+
+void FECCompiledMessageFormat::AppendTo(FStringBuilderBase& Out, TArrayView<const FStringFormatArg> Args) const
+{
+	for (const FSegment& Segment : Segments)
+	{
+		if (Segment.ArgIndex == INDEX_NONE || !Args.IsValidIndex(Segment.ArgIndex))
+		{
+			Out.Append(*Literals + Segment.LiteralStart, Segment.LiteralLen);
+			continue;
+		}
+
+		const FStringFormatArg& Arg = Args[Segment.ArgIndex];
+		switch (Arg.Type)
+		{
+			case FStringFormatArg::Int:
+				Out.Appendf(TEXT("%lld"), Arg.IntValue);
+				break;
+			case FStringFormatArg::UInt:
+				Out.Appendf(TEXT("%llu"), Arg.UIntValue);
+				break;
+			case FStringFormatArg::Double:
+				Out.Appendf(TEXT("%f"), Arg.DoubleValue);
+				break;
+			case FStringFormatArg::String:
+				Out << Arg.StringValue;
+				break;
+			case FStringFormatArg::StringLiteral:
+				Out << Arg.StringLiteralValue;
+				break;
+			default:
+				checkNoEntry();
+		}
+	}
+}
+
+FECMessageFormatCache& FECMessageFormatCache::Get()
+{
+	static FECMessageFormatCache Cache;
+	return Cache;
+}
+
+FECMessageFormatCache::FECMessageFormatCache()
+{
+	// Messages are localized, so every template may change with the culture.
+	FInternationalization::Get().OnCultureChanged().AddRaw(this, &FECMessageFormatCache::Reset);
+
+#if WITH_EDITORONLY_DATA
+	UECErrorCategory::PostChangedInEditor().AddLambda(
+		[this](const UECErrorCategory& Category, const TArray<FECEnumNameValuePair>&, bool)
+		{
+			Invalidate(Category);
+		});
+#endif
+}
+
+TSharedRef<const FECCompiledMessageFormat, ESPMode::ThreadSafe> FECMessageFormatCache::FindOrCompile(
+	const FECResult& Result)
+{
+	{
+		FReadScopeLock ReadLock(Lock);
+		const FEntry* Entry = Entries.Find(Result);
+		if (Entry && Entry->Category.Get() == Result.GetCategory())
+		{
+			return Entry->Format;
+		}
+	}
+
+	// Compile outside the lock; GetMessage can be slow in editor builds.
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	TSharedRef<const FECCompiledMessageFormat, ESPMode::ThreadSafe> Format =
+		MakeShared<FECCompiledMessageFormat, ESPMode::ThreadSafe>(
+			FECCompiledMessageFormat::Compile(Result.GetMessage().ToString()));
+
+	FWriteScopeLock WriteLock(Lock);
+	Entries.Add(Result, FEntry{Result.GetCategory(), Format});
+	return Format;
+}
+
+void FECMessageFormatCache::Invalidate(const UEnum& Category)
+{
+	FWriteScopeLock WriteLock(Lock);
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It->Key.GetCategory() == &Category)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FECMessageFormatCache::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+	Entries.Reset();
+}
+
+void Mgnc::AppendFormattedResultMessage(FStringBuilderBase& Out,
+	const FECResult& Result,
+	TArrayView<const FStringFormatArg> Args
+	)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ECFormatResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, FormatResult);
+
+	FECMessageFormatCache::Get().FindOrCompile(Result)->AppendTo(Out, Args);
+}
+
+FString Mgnc::FormatResultMessage(const FECResult& Result, TArrayView<const FStringFormatArg> Args)
+{
+	TStringBuilder<256> Builder;
+	AppendFormattedResultMessage(Builder, Result, Args);
+	return FString(Builder.ToView());
+}
@@ -0,0 +1,171 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECMetricsExporter.h"
+
+#include "ECLogging.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace Mgnc::Detail
+{
+static TAutoConsoleVariable<FString> CVarMetricsTextfilePath(
+	TEXT("ec.Metrics.TextfilePath"),
+	FString(),
+	TEXT("Path of the Prometheus/OpenMetrics text file to write result failure metrics to. Empty disables the exporter."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMetricsIntervalSeconds(
+	TEXT("ec.Metrics.IntervalSeconds"),
+	15.f,
+	TEXT("Seconds between writes of the result failure metrics file."),
+	ECVF_Default);
+
+// Escape a label value as required by the text exposition format.
+static void AppendLabelValue(FString& Out, const FString& Value)
+{
+	Out.Reserve(Out.Len() + Value.Len());
+	for (const TCHAR Char : Value)
+	{
+		switch (Char)
+		{
+			case TEXT('\\'):
+				Out += TEXT("\\\\");
+				break;
+			case TEXT('"'):
+				Out += TEXT("\\\"");
+				break;
+			case TEXT('\n'):
+				Out += TEXT("\\n");
+				break;
+			default:
+				Out.AppendChar(Char);
+				break;
+		}
+	}
+}
+} // namespace Mgnc::Detail
+
+void FECMetricsExporter::Startup()
+{
+	// Check the path every second so the exporter can be enabled or disabled at runtime.
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FECMetricsExporter::Tick), 1.f);
+	LastExportTime = FPlatformTime::Seconds();
+}
+
+void FECMetricsExporter::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+	}
+}
+
+bool FECMetricsExporter::Tick(float DeltaTime)
+{
+	const FString Path = Mgnc::Detail::CVarMetricsTextfilePath.GetValueOnGameThread();
+	const double Now = FPlatformTime::Seconds();
+	if (Path.IsEmpty())
+	{
+		LastExportTime = Now;
+		return true;
+	}
+
+	const double ElapsedSeconds = Now - LastExportTime;
+	if (ElapsedSeconds < FMath::Max(Mgnc::Detail::CVarMetricsIntervalSeconds.GetValueOnGameThread(), 1.f))
+	{
+		return true;
+	}
+
+	// Don't queue up writes if the file system is slower than the export interval.
+	if (PendingWrite.IsValid() && !PendingWrite.IsCompleted())
+	{
+		return true;
+	}
+
+	LastExportTime = Now;
+	TArray<FECFailureCountSnapshot> Counts;
+	FECFailureCounters::Get().Snapshot(Counts);
+
+	PendingWrite = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Counts = MoveTemp(Counts), PreviousCounts = PreviousCounts, Path, ElapsedSeconds]()
+		{
+			const FString Contents = FormatSnapshot(Counts, *PreviousCounts, ElapsedSeconds);
+			WriteFileAtomic(Path, Contents);
+
+			PreviousCounts->Reset();
+			for (const FECFailureCountSnapshot& Count : Counts)
+			{
+				FString Labels;
+				Labels += Count.CategoryName;
+				Labels += TEXT(':');
+				Labels += Count.CodeName;
+				PreviousCounts->Add(MoveTemp(Labels), Count.Count);
+			}
+		},
+		UE::Tasks::ETaskPriority::BackgroundLow);
+
+	return true;
+}
+
+FString FECMetricsExporter::FormatSnapshot(const TArray<FECFailureCountSnapshot>& Counts,
+	const TMap<FString, uint64>& PreviousCounts,
+	double ElapsedSeconds
+	)
+{
+	FString Labels;
+	FString Totals;
+	FString Rates;
+	for (const FECFailureCountSnapshot& Count : Counts)
+	{
+		Labels.Reset();
+		Labels += TEXT("{category=\"");
+		Mgnc::Detail::AppendLabelValue(Labels, Count.CategoryName);
+		Labels += TEXT("\",code=\"");
+		Mgnc::Detail::AppendLabelValue(Labels, Count.CodeName);
+		Labels += TEXT("\"}");
+
+		const uint64* PreviousCount = PreviousCounts.Find(Count.CategoryName + TEXT(":") + Count.CodeName);
+		// Counters can be reset at runtime; treat a decrease as a restart from zero.
+		const uint64 Delta = PreviousCount && *PreviousCount <= Count.Count ? Count.Count - *PreviousCount : Count.Count;
+		const double Rate = ElapsedSeconds > 0.0 ? static_cast<double>(Delta) / ElapsedSeconds : 0.0;
+
+		Totals += FString::Printf(TEXT("ec_result_failures_total%s %llu\n"), *Labels, Count.Count);
+		Rates += FString::Printf(TEXT("ec_result_failure_rate%s %.6f\n"), *Labels, Rate);
+	}
+
+	FString Contents;
+	Contents.Reserve(Totals.Len() + Rates.Len() + 256);
+	Contents += TEXT("# HELP ec_result_failures_total Number of failing results reported since startup.\n");
+	Contents += TEXT("# TYPE ec_result_failures_total counter\n");
+	Contents += Totals;
+	Contents += TEXT("# HELP ec_result_failure_rate Failing results per second since the previous export.\n");
+	Contents += TEXT("# TYPE ec_result_failure_rate gauge\n");
+	Contents += Rates;
+	return Contents;
+}
+
+void FECMetricsExporter::WriteFileAtomic(const FString& Path, const FString& Contents)
+{
+	// The temporary file must be in the same directory so the move is a rename rather than a copy.
+	const FString TempPath = Path + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(Contents, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogErrorHandling, Warning, TEXT("Failed to write result metrics to '%s'."), *TempPath);
+		return;
+	}
+
+	if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		UE_LOG(LogErrorHandling, Warning, TEXT("Failed to move result metrics from '%s' to '%s'."), *TempPath, *Path);
+		IFileManager::Get().Delete(*TempPath);
+	}
+}
@@ -0,0 +1,43 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ECFailureReporting.h"
+#include "Tasks/Task.h"
+
+/**
+ * Periodically writes failure counters and rates to a text file in the Prometheus/OpenMetrics text format, for use with
+ * a node-level textfile collector.
+ *
+ * Disabled unless 'ec.Metrics.TextfilePath' is set. Snapshots are taken on the game thread; formatting and writing run
+ * on a background task. Files are written to a temporary file and then moved over the target, so the collector never
+ * reads a partially written file.
+ */
+class FECMetricsExporter
+{
+public:
+	void Startup();
+	void Shutdown();
+
+private:
+	bool Tick(float DeltaTime);
+
+	// Format a snapshot as Prometheus text. Runs on a background task.
+	static FString FormatSnapshot(const TArray<FECFailureCountSnapshot>& Counts,
+		const TMap<FString, uint64>& PreviousCounts,
+		double ElapsedSeconds
+	);
+	static void WriteFileAtomic(const FString& Path, const FString& Contents);
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	UE::Tasks::FTask PendingWrite;
+
+	// Counts from the previous export, keyed by series labels. Only accessed by the export task.
+	TSharedRef<TMap<FString, uint64>, ESPMode::ThreadSafe> PreviousCounts = MakeShared<TMap<FString, uint64>, ESPMode::ThreadSafe>();
+	double LastExportTime = 0.0;
+};
@@ -0,0 +1,101 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECPackedResults.h"
+
+#include "ECLogging.h"
+
+FECPackedResults::FECPackedResults()
+{
+	Table.Add(FECResult::Success());
+}
+
+void FECPackedResults::Add(const FECResult& Result)
+{
+	// Batches tend to repeat the previous result, so check it before searching the table.
+	if (!Indices.IsEmpty() && Table[Indices.Last()] == Result)
+	{
+		Indices.Add(Indices.Last());
+		return;
+	}
+
+	if (TableLookup.Num() != Table.Num())
+	{
+		TableLookup.Reset();
+		for (int32 TableIndex = 0; TableIndex < Table.Num(); ++TableIndex)
+		{
+			TableLookup.Add(Table[TableIndex], static_cast<uint16>(TableIndex));
+		}
+	}
+
+	uint16 TableIndex;
+	if (const uint16* ExistingIndex = TableLookup.Find(Result))
+	{
+		TableIndex = *ExistingIndex;
+	}
+	else if (Table.Num() < MAX_uint16)
+	{
+		TableIndex = static_cast<uint16>(Table.Add(Result));
+		TableLookup.Add(Result, TableIndex);
+	}
+	else
+	{
+		// Dropping the element would shift every later position, and wrapping the index would pack it as 'Success', so
+		// the last index is kept for an overflow failure.
+		const FECResult Overflow = EECPackedResultsError::TooManyDistinctResults;
+		if (const uint16* OverflowIndex = TableLookup.Find(Overflow))
+		{
+			TableIndex = *OverflowIndex;
+		}
+		else
+		{
+			UE_LOG(LogErrorHandling, Error, TEXT("FECPackedResults can hold at most %d distinct results; packing '%s' as '%s'."),
+				MAX_uint16 + 1, *Result.ToShortString(), *Overflow.ToShortString());
+			TableIndex = static_cast<uint16>(Table.Add(Overflow));
+			TableLookup.Add(Overflow, TableIndex);
+		}
+	}
+	Indices.Add(TableIndex);
+}
+
+void FECPackedResults::Reserve(int32 Number)
+{
+	Indices.Reserve(Number);
+}
+
+void FECPackedResults::Reset()
+{
+	Table.Reset();
+	Table.Add(FECResult::Success());
+	Indices.Reset();
+	TableLookup.Reset();
+}
+
+bool FECPackedResults::AllSucceeded() const
+{
+	return Table.Num() == 1;
+}
+
+int32 FECPackedResults::FindFirstFailure() const
+{
+	return Indices.IndexOfByPredicate([](uint16 TableIndex) { return TableIndex != 0; });
+}
+
+int32 FECPackedResults::CountFailures() const
+{
+	int32 NumFailures = 0;
+	for (const uint16 TableIndex : Indices)
+	{
+		NumFailures += TableIndex != 0 ? 1 : 0;
+	}
+	return NumFailures;
+}
+
+TArray<FECResult> FECPackedResults::GetDistinctFailures() const
+{
+	// Every table entry after 'Success' was added for a failing element.
+	return TArray<FECResult>(Table.GetData() + 1, Table.Num() - 1);
+}
@@ -0,0 +1,23 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECParallelValidate.h"
+
+#include "Async/TaskGraphInterfaces.h"
+
+namespace Mgnc::Detail
+{
+// Validation predicates are usually cheap, so chunks must be large enough to outweigh the cost of scheduling them.
+static constexpr int32 MinElementsPerChunk = 64;
+// Several chunks per worker lets idle workers pick up the remainder when predicate costs vary.
+static constexpr int32 ChunksPerWorker = 4;
+} // namespace Mgnc::Detail
+
+int32 Mgnc::Detail::GetParallelValidateNumChunks(int32 NumElements)
+{
+	const int32 NumWorkers = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	return FMath::Clamp(NumElements / MinElementsPerChunk, 1, NumWorkers * ChunksPerWorker);
+}
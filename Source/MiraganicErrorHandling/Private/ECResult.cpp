@@ -7,6 +7,7 @@
 #include "ECResult.h"
 
 #include "ECLogging.h"
+#include "ECStats.h"
 
 #define LOCTEXT_NAMESPACE "ErrorHandling"
 
@@ -119,6 +120,9 @@ FText FECResult::GetCategoryName() const
 
 FText FECResult::GetFormattedMessage() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_ECFormatResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, FormatResult);
+
 	if (IsSuccess())
 	{
 		return LOCTEXT("ErrorCode_Msg_Success", "Success");
@@ -166,6 +170,9 @@ FText FECResult::GetTitle() const
 
 FString FECResult::ToShortString() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_ECFormatResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, FormatResult);
+
 	if (IsSuccess())
 	{
 		return TEXT("Success");
@@ -182,6 +189,9 @@ FString FECResult::ToShortString() const
 
 FString FECResult::ToString() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_ECFormatResult);
+	CSV_SCOPED_TIMING_STAT(ErrorHandling, FormatResult);
+
 	if (IsSuccess())
 	{
 		return TEXT("Success");
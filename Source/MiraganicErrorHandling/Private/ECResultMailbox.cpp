@@ -0,0 +1,46 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECResultMailbox.h"
+
+#include "ECStats.h"
+
+FECResultMailbox& FECResultMailbox::Get()
+{
+	static FECResultMailbox Mailbox;
+	return Mailbox;
+}
+
+void FECResultMailbox::Post(const FECResult& Result, UObject* Context, int64 Handle)
+{
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	FECPostedResult Posted;
+	Posted.Result = Result;
+	Posted.Context = Context;
+	Posted.Handle = Handle;
+	Queue.Enqueue(MoveTemp(Posted));
+}
+
+int32 FECResultMailbox::Drain(TArray<FECPostedResult>& OutResults, int32 MaxResults)
+{
+	int32 NumDrained = 0;
+	while (NumDrained < MaxResults)
+	{
+		TOptional<FECPostedResult> Posted = Queue.Dequeue();
+		if (!Posted.IsSet())
+		{
+			break;
+		}
+		OutResults.Add(MoveTemp(Posted.GetValue()));
+		++NumDrained;
+	}
+	return NumDrained;
+}
+
+void Mgnc::PostResultToGameThread(const FECResult& Result, UObject* Context, int64 Handle)
+{
+	FECResultMailbox::Get().Post(Result, Context, Handle);
+}
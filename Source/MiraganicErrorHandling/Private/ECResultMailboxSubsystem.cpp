@@ -0,0 +1,68 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECResultMailboxSubsystem.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace Mgnc::Detail
+{
+static TAutoConsoleVariable<int32> CVarMailboxMaxPerTick(
+	TEXT("ec.Mailbox.MaxPerTick"),
+	256,
+	TEXT("Maximum number of posted results dispatched on the game thread per tick."),
+	ECVF_Default);
+} // namespace Mgnc::Detail
+
+void UECResultMailboxSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UECResultMailboxSubsystem::Tick));
+}
+
+void UECResultMailboxSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	CategoryDelegates.Empty();
+
+	Super::Deinitialize();
+}
+
+FECOnResultPosted& UECResultMailboxSubsystem::OnCategoryResultPosted(const UEnum& Category)
+{
+	TUniquePtr<FECOnResultPosted>& Delegate = CategoryDelegates.FindOrAdd(&Category);
+	if (!Delegate)
+	{
+		Delegate = MakeUnique<FECOnResultPosted>();
+	}
+	return *Delegate;
+}
+
+bool UECResultMailboxSubsystem::Tick(float DeltaTime)
+{
+	Batch.Reset();
+	const int32 MaxPerTick = FMath::Max(Mgnc::Detail::CVarMailboxMaxPerTick.GetValueOnGameThread(), 1);
+	if (FECResultMailbox::Get().Drain(Batch, MaxPerTick) == 0)
+	{
+		return true;
+	}
+
+	for (const FECPostedResult& Posted : Batch)
+	{
+		if (const TUniquePtr<FECOnResultPosted>* CategoryDelegate = CategoryDelegates.Find(Posted.Result.GetCategory()))
+		{
+			(*CategoryDelegate)->Broadcast(Posted);
+		}
+
+		OnResultPostedNative.Broadcast(Posted);
+		OnResultPosted.Broadcast(Posted);
+	}
+
+	return true;
+}
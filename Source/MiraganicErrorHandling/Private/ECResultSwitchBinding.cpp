@@ -0,0 +1,209 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECResultSwitchBinding.h"
+
+#include "ECErrorMacros.h"
+#include "ECLogging.h"
+#include "ECStats.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Misc/Crc.h"
+
+FECResultSwitchOutput::FECResultSwitchOutput(int32 InIndex)
+	: Index(InIndex)
+{
+	bool* const Bits[MaxBits] = {
+		&bBit0, &bBit1, &bBit2, &bBit3, &bBit4, &bBit5, &bBit6, &bBit7,
+		&bBit8, &bBit9, &bBit10, &bBit11, &bBit12, &bBit13, &bBit14, &bBit15,
+	};
+	for (int32 Bit = 0; Bit < MaxBits; ++Bit)
+	{
+		*Bits[Bit] = (InIndex & (1 << Bit)) != 0;
+	}
+}
+
+FName FECResultSwitchOutput::GetBitMemberName(int32 Bit)
+{
+	check(Bit >= 0 && Bit < MaxBits);
+	return *FString::Printf(TEXT("bBit%d"), Bit);
+}
+
+int32 FECResultSwitchTable::FindOutputIndex(const FECResult& Selection) const
+{
+	if (Selection.IsSuccess())
+	{
+		return 0;
+	}
+
+	if (const int32* OutputIndex = CaseLookup.Find(Selection))
+	{
+		return *OutputIndex;
+	}
+	if (const int32* OutputIndex = CategoryLookup.Find(Selection.GetCategory()))
+	{
+		return *OutputIndex;
+	}
+	return GetNumOutputs() - 1;
+}
+
+void FECResultSwitchTable::BuildLookup()
+{
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	CaseLookup.Reset();
+	CategoryLookup.Reset();
+	CategoryLookup.Reserve(Categories.Num());
+
+	// Earlier pins win, and exact cases come before groups, so the most specific case is found first.
+	int32 OutputIndex = 1;
+	for (const FECResult& Case : Cases)
+	{
+		CaseLookup.FindOrAdd(Case, OutputIndex++);
+	}
+	for (const FECResultSwitchGroup& Group : Groups)
+	{
+		for (const FECResult& Result : Group.Results)
+		{
+			if (Result.IsFailure())
+			{
+				CaseLookup.FindOrAdd(Result, OutputIndex);
+			}
+		}
+		++OutputIndex;
+	}
+	for (const UEnum* Category : Categories)
+	{
+		if (Category)
+		{
+			CategoryLookup.FindOrAdd(Category, OutputIndex);
+		}
+		++OutputIndex;
+	}
+}
+
+bool FECResultSwitchTable::HasSameCases(const FECResultSwitchTable& Other) const
+{
+	if (Cases != Other.Cases || Categories != Other.Categories || Groups.Num() != Other.Groups.Num())
+	{
+		return false;
+	}
+
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+	{
+		if (Groups[GroupIndex].Name != Other.Groups[GroupIndex].Name
+			|| Groups[GroupIndex].Results != Other.Groups[GroupIndex].Results)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FECResultSwitchTable::ComputeKey() const
+{
+	const auto HashResult = [](uint32 Hash, const FECResult& Result)
+	{
+		const FString CategoryPath = GetPathNameSafe(Result.GetCategory());
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*CategoryPath));
+		return HashCombine(Hash, GetTypeHash(Result.GetValue()));
+	};
+
+	uint32 Hash = GetTypeHash(Cases.Num());
+	for (const FECResult& Case : Cases)
+	{
+		Hash = HashResult(Hash, Case);
+	}
+
+	Hash = HashCombine(Hash, GetTypeHash(Groups.Num()));
+	for (const FECResultSwitchGroup& Group : Groups)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Group.Results.Num()));
+		for (const FECResult& Result : Group.Results)
+		{
+			Hash = HashResult(Hash, Result);
+		}
+	}
+
+	Hash = HashCombine(Hash, GetTypeHash(Categories.Num()));
+	for (const UEnum* Category : Categories)
+	{
+		const FString CategoryPath = GetPathNameSafe(Category);
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*CategoryPath));
+	}
+	return static_cast<int32>(Hash);
+}
+
+void UECResultSwitchBinding::PostLoad()
+{
+	Super::PostLoad();
+
+	for (FECResultSwitchTable& Table : Tables)
+	{
+		Table.BuildLookup();
+	}
+	BuildTableIndices();
+}
+
+bool UECResultSwitchBinding::AddTable(const FECResultSwitchTable& Table)
+{
+	if (CollidingKeys.Contains(Table.Key))
+	{
+		return false;
+	}
+
+	if (const FECResultSwitchTable* ExistingTable = FindTable(Table.Key))
+	{
+		if (ExistingTable->HasSameCases(Table))
+		{
+			return true;
+		}
+
+		// Routing through either table would send one of the switches to the wrong outputs.
+		UE_LOG(LogErrorHandling, Error, TEXT("%s: Two result switch or select nodes in '%s' have different cases with the same key (%d). Change the cases of one of them."),
+			EC_FUNCNAME, *GetNameSafe(GetOuter()), Table.Key);
+		CollidingKeys.Add(Table.Key);
+		TableIndices.Remove(Table.Key);
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	FECResultSwitchTable& NewTable = Tables.Add_GetRef(Table);
+	NewTable.BuildLookup();
+	TableIndices.Add(NewTable.Key, Tables.Num() - 1);
+	return true;
+}
+
+const FECResultSwitchTable* UECResultSwitchBinding::FindTable(int32 Key) const
+{
+	const int32* TableIndex = TableIndices.Find(Key);
+	return TableIndex ? &Tables[*TableIndex] : nullptr;
+}
+
+const FECResultSwitchTable* UECResultSwitchBinding::FindTableForClass(const UClass* Class, int32 Key)
+{
+	const UBlueprintGeneratedClass* BlueprintClass = Cast<UBlueprintGeneratedClass>(Class);
+	if (!BlueprintClass)
+	{
+		return nullptr;
+	}
+
+	const UECResultSwitchBinding* Binding = Cast<UECResultSwitchBinding>(
+		UBlueprintGeneratedClass::GetDynamicBindingObject(BlueprintClass, StaticClass()));
+	return Binding ? Binding->FindTable(Key) : nullptr;
+}
+
+void UECResultSwitchBinding::BuildTableIndices()
+{
+	LLM_SCOPE_BYTAG(ErrorHandling);
+	TableIndices.Reset();
+	TableIndices.Reserve(Tables.Num());
+	for (int32 TableIndex = 0; TableIndex < Tables.Num(); ++TableIndex)
+	{
+		if (!CollidingKeys.Contains(Tables[TableIndex].Key))
+		{
+			TableIndices.Add(Tables[TableIndex].Key, TableIndex);
+		}
+	}
+}
@@ -0,0 +1,119 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECRetry.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+bool FECRetryPolicy::IsRetryable(const FECResult& Result) const
+{
+	return Result.IsFailure() && (RetryableResults.IsEmpty() || RetryableResults.Contains(Result));
+}
+
+float FECRetryPolicy::GetDelayBeforeAttempt(int32 Attempt) const
+{
+	const float Delay = FMath::Min(
+		InitialDelaySeconds * FMath::Pow(BackoffMultiplier, static_cast<float>(FMath::Max(Attempt - 2, 0))),
+		MaxDelaySeconds);
+	const float Jitter = FMath::Clamp(JitterFraction, 0.f, 1.f);
+	return FMath::Max(Delay * (1.f + FMath::FRandRange(-Jitter, Jitter)), 0.f);
+}
+
+namespace Mgnc::Detail
+{
+struct FRetryState
+{
+	TWeakObjectPtr<UWorld> World;
+	FECRetryPolicy Policy;
+	TUniqueFunction<FECResult()> Attempt;
+	TUniqueFunction<void(const FECResult&, int32)> OnComplete;
+	FECCancellationToken Cancellation;
+	int32 NumAttempts = 0;
+	FTimerHandle TimerHandle;
+	FDelegateHandle WorldCleanupHandle;
+
+	~FRetryState()
+	{
+		// The pending timer was destroyed without firing.
+		Complete(EECOperationResult::Cancelled);
+	}
+
+	void Complete(const FECResult& Result)
+	{
+		if (WorldCleanupHandle.IsValid())
+		{
+			FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+			WorldCleanupHandle.Reset();
+		}
+
+		if (OnComplete)
+		{
+			TUniqueFunction<void(const FECResult&, int32)> Callback = MoveTemp(OnComplete);
+			OnComplete.Reset();
+			Callback(Result, NumAttempts);
+		}
+	}
+};
+
+static void RunRetryAttempt(const TSharedRef<FRetryState>& State)
+{
+	FECResult Result = Mgnc::CheckStopRequested(State->Cancellation);
+	if (Result.IsSuccess())
+	{
+		++State->NumAttempts;
+		Result = State->Attempt();
+	}
+
+	UWorld* World = State->World.Get();
+	const bool bCanRetry = Result != FECResult(EECOperationResult::Cancelled)
+		&& State->NumAttempts < State->Policy.MaxAttempts
+		&& State->Policy.IsRetryable(Result);
+	if (!bCanRetry || !World)
+	{
+		State->Complete(Result);
+		return;
+	}
+
+	// Timers can outlive the world (they may belong to the game instance), so cancel when the world is cleaned up.
+	if (!State->WorldCleanupHandle.IsValid())
+	{
+		State->WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda(
+			[WeakState = TWeakPtr<FRetryState>(State)](UWorld* CleanedUpWorld, bool bSessionEnded, bool bCleanupResources)
+			{
+				const TSharedPtr<FRetryState> PinnedState = WeakState.Pin();
+				if (PinnedState && CleanedUpWorld == PinnedState->World.Get())
+				{
+					CleanedUpWorld->GetTimerManager().ClearTimer(PinnedState->TimerHandle);
+					PinnedState->Complete(EECOperationResult::Cancelled);
+				}
+			});
+	}
+
+	// The timer owns the state until the next attempt.
+	World->GetTimerManager().SetTimer(
+		State->TimerHandle,
+		FTimerDelegate::CreateLambda([State]() { RunRetryAttempt(State); }),
+		FMath::Max(State->Policy.GetDelayBeforeAttempt(State->NumAttempts + 1), UE_KINDA_SMALL_NUMBER),
+		false);
+}
+} // namespace Mgnc::Detail
+
+void Mgnc::RetryWithBackoff(UWorld& World,
+	const FECRetryPolicy& Policy,
+	TUniqueFunction<FECResult()> Attempt,
+	TUniqueFunction<void(const FECResult& Result, int32 NumAttempts)> OnComplete,
+	const FECCancellationToken& Cancellation
+	)
+{
+	const TSharedRef<Detail::FRetryState> State = MakeShared<Detail::FRetryState>();
+	State->World = &World;
+	State->Policy = Policy;
+	State->Attempt = MoveTemp(Attempt);
+	State->OnComplete = MoveTemp(OnComplete);
+	State->Cancellation = Cancellation;
+	Detail::RunRetryAttempt(State);
+}
@@ -0,0 +1,277 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECSpawnPlan.h"
+
+#include "ECActorSpawning.h"
+#include "Engine/Level.h"
+
+TECValueOrResult<FECSpawnPlan> FECSpawnPlan::Prepare(UWorld& World,
+	UClass& ActorClass,
+	const FActorSpawnParameters& SpawnParams
+	)
+{
+	// NOTE: All checks are copied from UWorld::SpawnActor
+	if (ActorClass.HasAnyClassFlags(CLASS_Deprecated))
+	{
+		return EECSpawnActorResult::ClassDeprecated;
+	}
+	if (ActorClass.HasAnyClassFlags(CLASS_Abstract))
+	{
+		return EECSpawnActorResult::ClassAbstract;
+	}
+	if (!ActorClass.IsChildOf(AActor::StaticClass()))
+	{
+		return EECSpawnActorResult::ClassWasNotActor;
+	}
+	if (SpawnParams.Template && SpawnParams.Template->GetClass() != &ActorClass)
+	{
+		return EECSpawnActorResult::TemplateClassMismatch;
+	}
+#if WITH_EDITOR
+	if (SpawnParams.OverridePackage && SpawnParams.bCreateActorPackage)
+	{
+		return EECSpawnActorResult::CannotOverrideAndCreatePackage;
+	}
+#endif
+
+	FECSpawnPlan Plan;
+	Plan.World = &World;
+	Plan.ActorClass = &ActorClass;
+	Plan.SpawnParams = SpawnParams;
+	Plan.Owner = SpawnParams.Owner;
+	Plan.Instigator = SpawnParams.Instigator;
+	Plan.SpawnParams.Owner = nullptr;
+	Plan.SpawnParams.Instigator = nullptr;
+#if WITH_EDITOR
+	Plan.OverridePackage = SpawnParams.OverridePackage;
+	Plan.SpawnParams.OverridePackage = nullptr;
+#endif
+	Plan.PreparedCollisionHandling = SpawnParams.SpawnCollisionHandlingOverride;
+	ULevel* Level = SpawnParams.OverrideLevel
+						? SpawnParams.OverrideLevel
+						: SpawnParams.Owner
+							? SpawnParams.Owner->GetLevel()
+							: World.GetCurrentLevel();
+	Plan.Level = Level;
+	AActor* Template = SpawnParams.Template ? SpawnParams.Template : ActorClass.GetDefaultObject<AActor>();
+	check(Template);
+	Plan.Template = Template;
+
+#if WITH_EDITOR
+	if (SpawnParams.OverridePackage)
+	{
+		Plan.bNeedGloballyUniqueName = true;
+	}
+	else if (Level->ShouldCreateNewExternalActors() && SpawnParams.bCreateActorPackage && !(SpawnParams.ObjectFlags & RF_Transient))
+	{
+		Plan.bNeedGloballyUniqueName = CastChecked<AActor>(ActorClass.GetDefaultObject())->SupportsExternalPackaging();
+	}
+	if (!GIsEditor)
+	{
+		Plan.bNeedGloballyUniqueName = false;
+	}
+#endif // WITH_EDITOR
+
+	if (!World.CanCreateInCurrentContext(Template))
+	{
+		return EECSpawnActorResult::NetworkContextMismatch;
+	}
+
+	ESpawnActorCollisionHandlingMethod CollisionHandlingOverride = SpawnParams.SpawnCollisionHandlingOverride;
+	if (SpawnParams.bNoFail)
+	{
+		if (CollisionHandlingOverride == ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding)
+		{
+			CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		}
+		else if (CollisionHandlingOverride == ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding)
+		{
+			CollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		}
+	}
+
+	const ESpawnActorCollisionHandlingMethod CollisionHandlingMethod =
+		CollisionHandlingOverride == ESpawnActorCollisionHandlingMethod::Undefined
+			? Template->SpawnCollisionHandlingMethod
+			: CollisionHandlingOverride;
+
+	if (CollisionHandlingMethod == ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding)
+	{
+		Plan.bCheckEncroachment = true;
+		// Execute does this check, so 'UWorld::SpawnActor' doesn't need to repeat it.
+		Plan.SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		if (const USceneComponent* TemplateRootComponent = Template->GetRootComponent())
+		{
+			Plan.TemplateRootTransform = TemplateRootComponent->GetRelativeTransform();
+		}
+	}
+
+	return MoveTemp(Plan);
+}
+
+FECResult FECSpawnPlan::Can_Execute(const FTransform& Transform) const
+{
+	EC_TRY_ASSIGN(const FActorSpawnParameters ExecParams, ResolveSpawnParams());
+	return CheckExecute(Transform, ExecParams);
+}
+
+FECResult FECSpawnPlan::Try_Execute(AActor*& OutSpawnedActor, const FTransform& Transform) const
+{
+	OutSpawnedActor = nullptr;
+	EC_TRY_ASSIGN(const FActorSpawnParameters ExecParams, ResolveSpawnParams());
+	EC_VALIDATE(CheckExecute(Transform, ExecParams));
+
+	return ExecuteChecked(OutSpawnedActor, Transform, ExecParams);
+}
+
+bool FECSpawnPlan::CanShareWith(const FActorSpawnParameters& OtherParams) const
+{
+	if (OtherParams.Template != SpawnParams.Template
+		|| OtherParams.OverrideLevel != SpawnParams.OverrideLevel
+		|| OtherParams.SpawnCollisionHandlingOverride != PreparedCollisionHandling
+		|| OtherParams.bNoFail != SpawnParams.bNoFail
+		|| OtherParams.bAllowDuringConstructionScript != SpawnParams.bAllowDuringConstructionScript
+		|| OtherParams.ObjectFlags != SpawnParams.ObjectFlags)
+	{
+		return false;
+	}
+#if WITH_EDITOR
+	if (OtherParams.OverridePackage != OverridePackage.Get()
+		|| OtherParams.bCreateActorPackage != SpawnParams.bCreateActorPackage)
+	{
+		return false;
+	}
+#endif
+
+	// The owner only matters for the level it puts the actor in.
+	if (!OtherParams.OverrideLevel && OtherParams.Owner != Owner.Get())
+	{
+		const ULevel* OtherLevel = OtherParams.Owner ? OtherParams.Owner->GetLevel() : World.IsValid() ? World->GetCurrentLevel() : nullptr;
+		return OtherLevel == Level.Get();
+	}
+	return true;
+}
+
+FECResult FECSpawnPlan::Can_Execute(const FTransform& Transform, const FActorSpawnParameters& InstanceParams) const
+{
+	checkSlow(CanShareWith(InstanceParams));
+	return CheckExecute(Transform, InstanceParams);
+}
+
+FECResult FECSpawnPlan::Try_Execute(AActor*& OutSpawnedActor,
+	const FTransform& Transform,
+	const FActorSpawnParameters& InstanceParams
+	) const
+{
+	OutSpawnedActor = nullptr;
+	EC_VALIDATE(Can_Execute(Transform, InstanceParams));
+
+	if (bCheckEncroachment)
+	{
+		// The check above covered blocking geometry, so the engine doesn't need to repeat it.
+		FActorSpawnParameters ExecParams = InstanceParams;
+		ExecParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return ExecuteChecked(OutSpawnedActor, Transform, ExecParams);
+	}
+	return ExecuteChecked(OutSpawnedActor, Transform, InstanceParams);
+}
+
+FECResult FECSpawnPlan::ExecuteChecked(AActor*& OutSpawnedActor,
+	const FTransform& Transform,
+	const FActorSpawnParameters& ExecParams
+	) const
+{
+	EC_VALIDATE(Mgnc::Exec_SpawnActor(OutSpawnedActor, *World.Get(), *ActorClass.Get(), Transform, ExecParams));
+
+	if (bCheckEncroachment && OutSpawnedActor)
+	{
+		// 'UWorld::SpawnActor' stores the forced 'AlwaysSpawn' on the actor, which would change how it's handled if it's
+		// respawned or duplicated. The plan only checks encroachment when the method resolved to this.
+		OutSpawnedActor->SpawnCollisionHandlingMethod = ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding;
+	}
+	return {};
+}
+
+FActorSpawnParameters FECSpawnPlan::GetSpawnParams() const
+{
+	FActorSpawnParameters Params = SpawnParams;
+	Params.Owner = Owner.Get();
+	Params.Instigator = Instigator.Get();
+#if WITH_EDITOR
+	Params.OverridePackage = OverridePackage.Get();
+#endif
+	return Params;
+}
+
+TECValueOrResult<FActorSpawnParameters> FECSpawnPlan::ResolveSpawnParams() const
+{
+	// Stale pointers were set when preparing and have been destroyed since; null ones were never set.
+	bool bExpired = Owner.IsStale() || Instigator.IsStale();
+#if WITH_EDITOR
+	bExpired |= OverridePackage.IsStale();
+#endif
+	if (bExpired)
+	{
+		return EECSpawnActorResult::SpawnPlanExpired;
+	}
+	return GetSpawnParams();
+}
+
+FECResult FECSpawnPlan::CheckExecute(const FTransform& Transform, const FActorSpawnParameters& InstanceParams) const
+{
+	UWorld* SpawnWorld = World.Get();
+	AActor* SpawnTemplate = Template.Get();
+	ULevel* SpawnLevel = Level.Get();
+	if (!SpawnWorld || !ActorClass.IsValid() || !SpawnTemplate || !SpawnLevel)
+	{
+		return EECSpawnActorResult::SpawnPlanExpired;
+	}
+	if (SpawnWorld->bIsRunningConstructionScript && !SpawnParams.bAllowDuringConstructionScript)
+	{
+		return EECSpawnActorResult::CalledFromConstructionScript;
+	}
+	if (SpawnWorld->bIsTearingDown)
+	{
+		return EECSpawnActorResult::WorldTearingDown;
+	}
+	if (Transform.ContainsNaN())
+	{
+		return EECSpawnActorResult::InvalidSpawnTransform;
+	}
+
+	const FName NewActorName = InstanceParams.Name;
+	if (!NewActorName.IsNone() && (StaticFindObjectFast(nullptr, SpawnLevel, NewActorName) || (bNeedGloballyUniqueName != FActorSpawnUtils::IsGloballyUniqueName(NewActorName) && InstanceParams.NameMode == FActorSpawnParameters::ESpawnActorNameMode::Requested)))
+	{
+		switch (InstanceParams.NameMode)
+		{
+			case FActorSpawnParameters::ESpawnActorNameMode::Required_Fatal:
+			case FActorSpawnParameters::ESpawnActorNameMode::Required_ErrorAndReturnNull:
+			case FActorSpawnParameters::ESpawnActorNameMode::Required_ReturnNull:
+				return EECSpawnActorResult::ObjectNameNotUnique;
+			case FActorSpawnParameters::ESpawnActorNameMode::Requested:
+				break;
+			default:
+				checkNoEntry();
+		}
+	}
+
+	if (bCheckEncroachment && IsEncroaching(Transform))
+	{
+		return EECSpawnActorResult::SpawnCollisionBlocked;
+	}
+
+	return {};
+}
+
+bool FECSpawnPlan::IsEncroaching(const FTransform& Transform) const
+{
+	const FTransform FinalRootComponentTransform = TemplateRootTransform * Transform;
+	const FVector FinalRootLocation = FinalRootComponentTransform.GetLocation();
+	const FRotator FinalRootRotation = FinalRootComponentTransform.Rotator();
+	// Unclear why UWorld::EncroachingBlockingGeometry is not const; probably an oversight
+	return World->EncroachingBlockingGeometry(Template.Get(), FinalRootLocation, FinalRootRotation);
+}
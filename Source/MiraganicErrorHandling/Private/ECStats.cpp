@@ -0,0 +1,15 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECStats.h"
+
+DEFINE_STAT(STAT_ECFailuresReported);
+DEFINE_STAT(STAT_ECFormatResult);
+DEFINE_STAT(STAT_ECLogResult);
+
+CSV_DEFINE_CATEGORY_MODULE(MIRAGANICERRORHANDLING_API, ErrorHandling, true);
+
+LLM_DEFINE_TAG(ErrorHandling);
@@ -0,0 +1,15 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECValueOrResult.h"
+
+#include "ECLogging.h"
+
+void Mgnc::Detail::LogValueOrResultConstructedFromSuccess()
+{
+	UE_LOG(LogErrorHandling, Error,
+		TEXT("TECValueOrResult must be constructed with a value or a failing result; it was constructed from 'Success'."));
+}
@@ -6,8 +6,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ECCancellation.h"
 #include "ECErrorMacros.h"
+#include "ECPackedResults.h"
 #include "ECResult.h"
+#include "ECSpawnPlan.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/World.h"
 #include "ECActorSpawning.generated.h"
@@ -43,6 +46,8 @@ enum class EECSpawnActorResult : int64
 	SpawnCollisionBlocked,
 	// Actor was destroyed by spawn notifications (BeginPlay, etc.).
 	InvalidatedBySpawnNotifications,
+	// An object a spawn plan was prepared with (its world, class, or an object in its spawn parameters) was destroyed.
+	SpawnPlanExpired,
 };
 
 namespace Mgnc
@@ -52,7 +57,8 @@ namespace Mgnc
 // ~ UWorld::SpawnActor
 
 /**
- * Check if a 'UWorld::SpawnActor' call would succeed.
+ * Check if a 'UWorld::SpawnActor' call would succeed. When spawning the same class many times, prepare an FECSpawnPlan
+ * instead, so the class checks only run once.
  *
  * NOTE: This does not check whether the actor would be invalidated by spawn notifications, as that requires the actor
  * to actually be spawned.
@@ -85,6 +91,49 @@ MIRAGANICERRORHANDLING_API UE_NODISCARD FECResult Try_SpawnActor(AActor*& OutSpa
 	const FActorSpawnParameters& SpawnParams
 	);
 
+/**
+ * Spawn an actor unless the operation was cancelled or its deadline passed.
+ */
+MIRAGANICERRORHANDLING_API FECResult Exec_SpawnActor(
+	AActor*& OutSpawnedActor,
+	UWorld& World,
+	UClass& ActorClass,
+	const FTransform& Transform,
+	const FActorSpawnParameters& SpawnParams,
+	const FECCancellationToken& Cancellation,
+	const FECDeadline& Deadline = FECDeadline::Never()
+);
+
+/**
+ * Try to spawn an actor unless the operation was cancelled or its deadline passed.
+ */
+MIRAGANICERRORHANDLING_API UE_NODISCARD FECResult Try_SpawnActor(AActor*& OutSpawnedActor,
+	UWorld& World,
+	UClass& ActorClass,
+	const FTransform& Transform,
+	const FActorSpawnParameters& SpawnParams,
+	const FECCancellationToken& Cancellation,
+	const FECDeadline& Deadline = FECDeadline::Never()
+	);
+
+/**
+ * Try to spawn one actor of a class per transform. 'SpawnParams' holds either one set of parameters for every instance,
+ * or one set per transform.
+ *
+ * The class checks run once for each run of instances whose parameters can share an FECSpawnPlan. An instance
+ * requiring a name an earlier instance spawned with fails the plan's name check with 'ObjectNameNotUnique'. Once cancelled, the remaining instances fail with 'Cancelled'.
+ *
+ * @param OutSpawnedActors The actor spawned for each transform, or null if that instance failed.
+ * @return The result for each transform.
+ */
+MIRAGANICERRORHANDLING_API FECPackedResults Try_SpawnActorBatch(TArray<AActor*>& OutSpawnedActors,
+	UWorld& World,
+	UClass& ActorClass,
+	TConstArrayView<FTransform> Transforms,
+	TConstArrayView<FActorSpawnParameters> SpawnParams,
+	const FECCancellationToken& Cancellation = FECCancellationToken()
+	);
+
 //----------------------------------------------------------------------------------------------------------------------
 // ~ UWorld::SpawnActor (Templated)
 
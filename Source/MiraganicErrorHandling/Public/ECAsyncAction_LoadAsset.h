@@ -0,0 +1,46 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECAsyncAction_Result.h"
+#include "ECAsyncAction_LoadAsset.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FECOnAssetLoaded, FECResult, Result, UObject*, Asset);
+
+/**
+ * Latent Blueprint node which loads an asset without blocking the game thread.
+ */
+UCLASS()
+class MIRAGANICERRORHANDLING_API UECAsyncAction_LoadAsset : public UECAsyncAction_Result
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UECAsyncAction_LoadAsset* LoadAssetWithResult(UObject* WorldContextObject, TSoftObjectPtr<UObject> Asset);
+
+	virtual void Activate() override;
+
+	// Called with the loaded asset.
+	UPROPERTY(BlueprintAssignable)
+	FECOnAssetLoaded OnSuccess;
+
+	// Called if the path was empty, the load failed, or the action was cancelled.
+	UPROPERTY(BlueprintAssignable)
+	FECOnAssetLoaded OnFailure;
+
+protected:
+	virtual void OnCancelRequested() override;
+	virtual void BroadcastResult(const FECResult& Result) override;
+
+private:
+	TSoftObjectPtr<UObject> Asset;
+
+	UPROPERTY()
+	TObjectPtr<UObject> LoadedAsset;
+};
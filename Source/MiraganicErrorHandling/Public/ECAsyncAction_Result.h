@@ -0,0 +1,66 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECCancellation.h"
+#include "ECResult.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "ECAsyncAction_Result.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Errors from loading an asset asynchronously.
+ */
+UENUM(meta = (ErrorCategory))
+enum class EECAsyncLoadResult : int64
+{
+	Success = 0,
+	// The asset path was empty.
+	InvalidPath,
+	// The asset couldn't be loaded, or isn't the expected type.
+	LoadFailed,
+};
+
+/**
+ * Base class for latent Blueprint nodes which finish with a result. Subclasses declare 'OnSuccess' and 'OnFailure'
+ * delegates with the result and any payload, start their work in Activate, and call Complete once it's done.
+ */
+UCLASS(Abstract)
+class MIRAGANICERRORHANDLING_API UECAsyncAction_Result : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	// Stop the action. Depending on the action, it completes with 'Cancelled' now or once its current step finishes.
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling")
+	void Cancel();
+
+	bool IsComplete() const { return bIsComplete; }
+
+protected:
+	// Called by Cancel, unless the action already completed.
+	virtual void OnCancelRequested() {}
+
+	// Broadcast the result to the subclass' delegates. Called once, by Complete.
+	virtual void BroadcastResult(const FECResult& Result) PURE_VIRTUAL(UECAsyncAction_Result::BroadcastResult, );
+
+	// Finish the action with a result. Later calls are ignored.
+	void Complete(const FECResult& Result);
+
+	/**
+	 * Load an asset without blocking the game thread. 'OnLoaded' is called on the game thread, immediately if the asset
+	 * is already loaded. It isn't called if the action is cancelled or destroyed first.
+	 */
+	void RequestAsyncLoad(const FSoftObjectPath& Path, TFunction<void(const FECResult&, UObject*)> OnLoaded);
+
+	FECCancellationToken Cancellation = FECCancellationToken::Create();
+
+private:
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	bool bIsComplete = false;
+};
@@ -0,0 +1,53 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECAsyncAction_Result.h"
+#include "ECRetry.h"
+#include "ECAsyncAction_Retry.generated.h"
+
+DECLARE_DYNAMIC_DELEGATE_RetVal(FECResult, FECRetryAttemptDynamic);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FECOnRetryComplete, FECResult, Result, int32, NumAttempts);
+
+/**
+ * Latent Blueprint node which calls an event until it succeeds or the retry policy gives up.
+ */
+UCLASS()
+class MIRAGANICERRORHANDLING_API UECAsyncAction_Retry : public UECAsyncAction_Result
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Call 'Attempt' until it returns 'Success', returns a failure the policy doesn't retry, or runs out of attempts.
+	 * Retries are scheduled with timers, so nothing runs between attempts.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UECAsyncAction_Retry* RetryWithBackoff(UObject* WorldContextObject, FECRetryAttemptDynamic Attempt,
+		const FECRetryPolicy& Policy);
+
+	virtual void Activate() override;
+
+	// Called when an attempt succeeded.
+	UPROPERTY(BlueprintAssignable)
+	FECOnRetryComplete OnSuccess;
+
+	// Called with the last failure when the policy gives up. If cancelled, this is called with 'Cancelled' before the
+	// next attempt would have run.
+	UPROPERTY(BlueprintAssignable)
+	FECOnRetryComplete OnFailure;
+
+protected:
+	virtual void BroadcastResult(const FECResult& Result) override;
+
+private:
+	TWeakObjectPtr<UWorld> World;
+	FECRetryAttemptDynamic Attempt;
+	FECRetryPolicy Policy;
+	int32 NumAttemptsMade = 0;
+};
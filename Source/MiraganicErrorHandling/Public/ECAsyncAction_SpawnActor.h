@@ -0,0 +1,59 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECAsyncAction_Result.h"
+#include "Engine/EngineTypes.h"
+#include "ECAsyncAction_SpawnActor.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FECOnActorSpawned, FECResult, Result, AActor*, Actor);
+
+/**
+ * Latent Blueprint node which loads an actor class without blocking the game thread, then spawns it with
+ * Mgnc::Try_SpawnActor, so failures keep their EECSpawnActorResult.
+ */
+UCLASS()
+class MIRAGANICERRORHANDLING_API UECAsyncAction_SpawnActor : public UECAsyncAction_Result
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UECAsyncAction_SpawnActor* SpawnActorWithResult(UObject* WorldContextObject,
+		TSoftClassPtr<AActor> ActorClass,
+		const FTransform& SpawnTransform,
+		ESpawnActorCollisionHandlingMethod CollisionHandling,
+		AActor* Owner
+		);
+
+	virtual void Activate() override;
+
+	// Called with the spawned actor.
+	UPROPERTY(BlueprintAssignable)
+	FECOnActorSpawned OnSuccess;
+
+	// Called if the class couldn't be loaded, the spawn failed, or the action was cancelled.
+	UPROPERTY(BlueprintAssignable)
+	FECOnActorSpawned OnFailure;
+
+protected:
+	virtual void OnCancelRequested() override;
+	virtual void BroadcastResult(const FECResult& Result) override;
+
+private:
+	void SpawnLoadedClass(UClass* LoadedClass);
+
+	TWeakObjectPtr<UWorld> World;
+	TSoftClassPtr<AActor> ActorClass;
+	FTransform SpawnTransform;
+	ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::Undefined;
+	TWeakObjectPtr<AActor> Owner;
+
+	UPROPERTY()
+	TObjectPtr<AActor> SpawnedActor;
+};
@@ -0,0 +1,122 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ECResult.h"
+#include "Tasks/Task.h"
+
+/**
+ * How often failures from a category capture a callstack.
+ */
+struct FECCallstackSamplingPolicy
+{
+	// Capture one in every N failures. 0 disables 1-in-N sampling.
+	int32 SampleEveryN = 0;
+	// Capture at most this many callstacks per minute. 0 disables capturing.
+	int32 MaxPerMinute = 10;
+};
+
+/**
+ * Captures raw callstacks for a sample of failures. Enabled with 'ec.Callstacks.Enable', which is available in Test and
+ * Shipping builds.
+ *
+ * Capturing only walks the stack into a preallocated pool; symbolication happens later on a background task. With
+ * 'ec.Callstacks.Symbolicate 0' frames are logged as module+offset instead, for decoding offline against the build's
+ * symbols.
+ *
+ * Callstacks are written to 'Saved/Logs/ErrorHandlingCallstacks.log', which unlike the output log is also written in
+ * Shipping builds.
+ */
+class MIRAGANICERRORHANDLING_API FECCallstackSampler
+{
+public:
+	static constexpr int32 MaxDepth = 32;
+	static constexpr int32 PoolSize = 32;
+	// Number of categories with their own sampling state. Failures from further categories are not sampled.
+	static constexpr int32 MaxCategories = 256;
+
+	static FECCallstackSampler& Get();
+
+	void Startup();
+	void Shutdown();
+
+	// Capture the current callstack if the failure is selected by its category's sampling policy.
+	void SampleFailure(const FECResult& Result);
+
+	// Override the sampling policy for a category (the CVar defaults are used otherwise). Has no effect once
+	// MaxCategories categories have failed.
+	void SetCategoryPolicy(const UEnum& Category, const FECCallstackSamplingPolicy& Policy);
+	void ClearCategoryPolicy(const UEnum& Category);
+
+private:
+	enum class ESlotState : uint8
+	{
+		Free,
+		Writing,
+		Ready,
+		Symbolicating,
+	};
+
+	struct FSlot
+	{
+		std::atomic<ESlotState> State{ESlotState::Free};
+		FECResult Result;
+		uint32 ThreadId = 0;
+		uint32 NumFrames = 0;
+		uint64 Frames[MaxDepth];
+	};
+
+	struct FModuleRange
+	{
+		uint64 BaseAddress = 0;
+		uint64 Size = 0;
+		FString Name;
+	};
+
+	// Sampling state for one category. Slots are claimed once and never freed, so sampling takes no lock and never
+	// allocates.
+	struct FCategoryState
+	{
+		std::atomic<const UEnum*> Category{nullptr};
+		// The policy override packed by PackPolicy, or 0 to use the CVars.
+		std::atomic<uint64> PackedPolicy{0};
+		std::atomic<uint32> NumFailures{0};
+		std::atomic<int32> NumCapturedThisMinute{0};
+		std::atomic<int64> Minute{0};
+	};
+
+	static uint64 PackPolicy(const FECCallstackSamplingPolicy& Policy);
+	static FECCallstackSamplingPolicy UnpackPolicy(uint64 PackedPolicy);
+
+	// Find or claim the state for a category. Null if every slot is claimed by other categories.
+	FCategoryState* FindCategoryState(const UEnum* Category);
+
+	bool ShouldSample(const FECResult& Result);
+	void Capture(const FECResult& Result);
+	bool Tick(float DeltaTime);
+	void LogSlot(const FSlot& Slot, bool bSymbolicate);
+	void WriteToFile(const FString& Text);
+
+	// Module lookup for raw frames. Only touched by the symbolication task, which never runs concurrently with itself.
+	const FModuleRange* FindModule(uint64 ProgramCounter, bool& bRefreshed);
+	void RefreshModules();
+
+	FSlot Slots[PoolSize];
+	std::atomic<uint32> NumDropped{0};
+
+	FCategoryState Categories[MaxCategories];
+	// State for results without a category.
+	FCategoryState InvalidCategoryState;
+
+	TArray<FModuleRange> Modules;
+	// Opened by the first logged callstack. Only touched by the symbolication task, and closed on shutdown.
+	TUniquePtr<FArchive> CallstackFile;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	UE::Tasks::FTask PendingSymbolication;
+};
@@ -0,0 +1,100 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECCancellation.generated.h"
+
+/**
+ * Errors for operations which were stopped before they finished.
+ */
+UENUM(meta = (ErrorCategory))
+enum class EECOperationResult : int64
+{
+	Success = 0,
+	// The operation was cancelled.
+	Cancelled,
+	// The operation didn't finish before its deadline.
+	DeadlineExceeded,
+};
+
+/**
+ * A flag for cooperatively cancelling an operation. Copies share the same flag, so the caller keeps one copy to cancel
+ * with, and the operation checks another. Checking is a single atomic load.
+ *
+ * A default constructed token can never be cancelled.
+ */
+class MIRAGANICERRORHANDLING_API FECCancellationToken
+{
+public:
+	FECCancellationToken() = default;
+
+	// Create a token which can be cancelled.
+	static FECCancellationToken Create();
+
+	// Cancel the operation. Safe to call from any thread.
+	void Cancel() const;
+
+	bool IsCancellationRequested() const
+	{
+		return State.IsValid() && State->load(std::memory_order_relaxed);
+	}
+
+	// Get 'Cancelled' if cancellation was requested, else 'Success'.
+	FECResult Check() const
+	{
+		return IsCancellationRequested() ? FECResult(EECOperationResult::Cancelled) : FECResult::Success();
+	}
+
+private:
+	TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> State;
+};
+
+/**
+ * A point in time after which an operation should give up.
+ */
+class MIRAGANICERRORHANDLING_API FECDeadline
+{
+public:
+	// A deadline which never expires.
+	FECDeadline() = default;
+
+	static FECDeadline Never() { return FECDeadline(); }
+	static FECDeadline After(double Seconds);
+
+	bool HasExpired() const
+	{
+		return EndSeconds < TNumericLimits<double>::Max() && FPlatformTime::Seconds() >= EndSeconds;
+	}
+
+	double GetRemainingSeconds() const;
+
+	// Get 'DeadlineExceeded' if the deadline passed, else 'Success'.
+	FECResult Check() const
+	{
+		return HasExpired() ? FECResult(EECOperationResult::DeadlineExceeded) : FECResult::Success();
+	}
+
+private:
+	double EndSeconds = TNumericLimits<double>::Max();
+};
+
+namespace Mgnc
+{
+/**
+ * Check whether an operation should stop: 'Cancelled' if it was cancelled, 'DeadlineExceeded' if its deadline passed,
+ * else 'Success'.
+ */
+FORCEINLINE FECResult CheckStopRequested(const FECCancellationToken& Cancellation, const FECDeadline& Deadline = FECDeadline::Never())
+{
+	if (Cancellation.IsCancellationRequested())
+	{
+		return EECOperationResult::Cancelled;
+	}
+	return Deadline.Check();
+}
+} // namespace Mgnc
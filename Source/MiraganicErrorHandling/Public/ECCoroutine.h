@@ -0,0 +1,400 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "ECResult.h"
+#include "ECTasks.h"
+#include "ECValueOrResult.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define EC_WITH_COROUTINES 1
+#else
+#define EC_WITH_COROUTINES 0
+#endif
+
+namespace Mgnc::Detail
+{
+// Coroutine frames are allocated from size-class pools. Frames larger than the biggest class use FMemory.
+MIRAGANICERRORHANDLING_API void* AllocateCoroutineFrame(SIZE_T Size);
+MIRAGANICERRORHANDLING_API void FreeCoroutineFrame(void* Frame, SIZE_T Size);
+} // namespace Mgnc::Detail
+
+#if EC_WITH_COROUTINES
+
+#include <coroutine>
+
+template<typename T>
+class TECCoroutine;
+
+namespace Mgnc::Detail
+{
+// The part of a coroutine's promise which doesn't depend on its result type, so failures can propagate to an awaiting
+// coroutine with a different result type.
+class FECCoroutinePromiseBase
+{
+public:
+	virtual ~FECCoroutinePromiseBase() = default;
+
+	// Finish this coroutine with a failure, without resuming it. Returns the coroutine to resume next.
+	virtual std::coroutine_handle<> CompleteWithFailure(const FECResult& Failure) = 0;
+
+	static void* operator new(SIZE_T Size)
+	{
+		return AllocateCoroutineFrame(Size);
+	}
+
+	static void operator delete(void* Frame, SIZE_T Size)
+	{
+		FreeCoroutineFrame(Frame, Size);
+	}
+
+	// The coroutine awaiting this one, if any.
+	std::coroutine_handle<> Continuation;
+	FECCoroutinePromiseBase* ContinuationPromise = nullptr;
+};
+
+// Types with their own await_transform overloads in TECCoroutinePromise.
+template<typename T>
+struct TIsTransformedAwaitable
+{
+	static constexpr bool Value = TIsResultType<T>::Value;
+};
+
+template<typename T>
+struct TIsTransformedAwaitable<UE::Tasks::TTask<T>>
+{
+	static constexpr bool Value = true;
+};
+
+template<typename T>
+struct TIsTransformedAwaitable<TECCoroutine<T>>
+{
+	static constexpr bool Value = true;
+};
+
+// Resume a suspended coroutine, or finish it with a failure if 'Result' failed.
+inline void ResumeOrFail(std::coroutine_handle<> Handle, FECCoroutinePromiseBase& Promise, const FECResult& Result)
+{
+	if (Result.IsFailure())
+	{
+		Promise.CompleteWithFailure(Result).resume();
+	}
+	else
+	{
+		Handle.resume();
+	}
+}
+
+// Awaits a synchronous result. Continues if it succeeded, otherwise finishes the awaiting coroutine with the failure.
+template<typename T>
+struct TECResultAwaiter
+{
+	T Result;
+	FECCoroutinePromiseBase& Promise;
+
+	bool await_ready() const { return GetResultOf(Result).IsSuccess(); }
+
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<>)
+	{
+		// Copy the failure, since completing may destroy this awaiter's frame.
+		const FECResult Failure = GetResultOf(Result);
+		return Promise.CompleteWithFailure(Failure);
+	}
+
+	auto await_resume()
+	{
+		if constexpr (!TIsSame<T, FECResult>::Value)
+		{
+			return Result.StealValue();
+		}
+	}
+};
+
+// Awaits a UE::Tasks task returning a result. The coroutine resumes on the thread which completed the task.
+template<typename T>
+struct TECTaskAwaiter
+{
+	UE::Tasks::TTask<T> Task;
+	FECCoroutinePromiseBase& Promise;
+
+	bool await_ready() const { return false; }
+
+	void await_suspend(std::coroutine_handle<> Handle)
+	{
+		UE::Tasks::Launch(
+			TEXT("Mgnc::TECTaskAwaiter"),
+			[Task = Task, Handle, &Promise = Promise]() mutable
+			{
+				ResumeOrFail(Handle, Promise, GetResultOf(Task.GetResult()));
+			},
+			UE::Tasks::Prerequisites(Task),
+			UE::Tasks::ETaskPriority::Normal,
+			UE::Tasks::EExtendedTaskPriority::Inline);
+	}
+
+	auto await_resume()
+	{
+		if constexpr (!TIsSame<T, FECResult>::Value)
+		{
+			return Task.GetResult().StealValue();
+		}
+	}
+};
+
+// Awaits another coroutine, starting it immediately.
+template<typename T>
+struct TECCoroutineAwaiter
+{
+	TECCoroutine<T> Coroutine;
+
+	bool await_ready() const { return false; }
+
+	template<typename PromiseT>
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> Awaiting)
+	{
+		auto& Promise = Coroutine.Handle.promise();
+		Promise.Continuation = Awaiting;
+		Promise.ContinuationPromise = &Awaiting.promise();
+		return Coroutine.Handle;
+	}
+
+	// Only reached if the coroutine succeeded.
+	auto await_resume()
+	{
+		if constexpr (!TIsSame<T, FECResult>::Value)
+		{
+			return Coroutine.Handle.promise().Result->StealValue();
+		}
+	}
+};
+
+template<typename T>
+class TECCoroutinePromise : public FECCoroutinePromiseBase
+{
+public:
+	TECCoroutine<T> get_return_object()
+	{
+		return TECCoroutine<T>(std::coroutine_handle<TECCoroutinePromise>::from_promise(*this));
+	}
+
+	// Coroutines don't run until they're awaited or started.
+	std::suspend_always initial_suspend() { return {}; }
+
+	auto final_suspend() noexcept
+	{
+		struct FFinalAwaiter
+		{
+			bool await_ready() noexcept { return false; }
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<TECCoroutinePromise> Handle) noexcept
+			{
+				return Handle.promise().Complete();
+			}
+			void await_resume() noexcept {}
+		};
+		return FFinalAwaiter{};
+	}
+
+	void return_value(T InResult)
+	{
+		Result.Emplace(MoveTemp(InResult));
+	}
+
+	void unhandled_exception()
+	{
+		checkNoEntry();
+	}
+
+	// Failing results and failing tasks end the coroutine with their failure, like EC_VALIDATE.
+	TECResultAwaiter<FECResult> await_transform(const FECResult& InResult)
+	{
+		return {InResult, *this};
+	}
+
+	template<typename ValueT>
+	TECResultAwaiter<TECValueOrResult<ValueT>> await_transform(TECValueOrResult<ValueT> InResult)
+	{
+		return {MoveTemp(InResult), *this};
+	}
+
+	template<typename TaskT>
+	TECTaskAwaiter<TaskT> await_transform(UE::Tasks::TTask<TaskT> Task)
+	{
+		static_assert(TIsResultType<TaskT>::Value, "Only tasks returning FECResult or TECValueOrResult can be awaited.");
+		return {MoveTemp(Task), *this};
+	}
+
+	template<typename OtherT>
+	TECCoroutineAwaiter<OtherT> await_transform(TECCoroutine<OtherT>&& Coroutine)
+	{
+		return {MoveTemp(Coroutine)};
+	}
+
+	// Other awaitables (e.g., Mgnc::ResumeOnGameThread) are used as-is.
+	template<typename AwaitableT, typename = typename TEnableIf<!TIsTransformedAwaitable<typename TDecay<AwaitableT>::Type>::Value>::Type>
+	AwaitableT&& await_transform(AwaitableT&& Awaitable)
+	{
+		return Forward<AwaitableT>(Awaitable);
+	}
+
+	virtual std::coroutine_handle<> CompleteWithFailure(const FECResult& Failure) override
+	{
+		Result.Emplace(T(Failure));
+		return Complete();
+	}
+
+	// Hand the result to whoever is waiting for it, and return the coroutine to resume next.
+	std::coroutine_handle<> Complete()
+	{
+		if (ContinuationPromise)
+		{
+			if (GetResultOf(*Result).IsFailure())
+			{
+				// Copy the failure, since the awaiting coroutine may destroy this one.
+				const FECResult Failure = GetResultOf(*Result);
+				return ContinuationPromise->CompleteWithFailure(Failure);
+			}
+			return Continuation;
+		}
+
+		if (bDetached)
+		{
+			TUniqueFunction<void(T)> Callback = MoveTemp(OnComplete);
+			T FinalResult = MoveTemp(*Result);
+			std::coroutine_handle<TECCoroutinePromise>::from_promise(*this).destroy();
+			if (Callback)
+			{
+				Callback(MoveTemp(FinalResult));
+			}
+		}
+		return std::noop_coroutine();
+	}
+
+	TOptional<T> Result;
+	TUniqueFunction<void(T)> OnComplete;
+	bool bDetached = false;
+};
+} // namespace Mgnc::Detail
+
+/**
+ * A coroutine returning FECResult or TECValueOrResult. Coroutines start suspended, and run when they're awaited by
+ * another coroutine or started with Start().
+ *
+ * Inside the coroutine, 'co_await' on a failing FECResult, TECValueOrResult, UE::Tasks::TTask returning either, or
+ * another TECCoroutine ends the coroutine with that failure, like EC_VALIDATE. Otherwise, 'co_await' returns the value
+ * (if any).
+ *
+ * E.g.,:
+ *
+ * TECCoroutine<FECResult> SpawnSquad(UWorld& World, TArray<UClass*> Classes)
+ * {
+ *     const FSquadData Data = co_await LoadSquadDataAsync();   // TECCoroutine<TECValueOrResult<FSquadData>>
+ *     co_await Mgnc::ResumeOnGameThread();
+ *     for (UClass* Class : Classes)
+ *     {
+ *         co_await Mgnc::Can_SpawnActor(World, *Class, Data.Transform, {});
+ *     }
+ *     co_return EECSpawnActorResult::Success;
+ * }
+ *
+ * SpawnSquad(World, Classes).Start([](FECResult Result) { ... });
+ *
+ * Frames are allocated from pools (see Mgnc::Detail::AllocateCoroutineFrame).
+ */
+template<typename T = FECResult>
+class UE_NODISCARD TECCoroutine
+{
+public:
+	static_assert(Mgnc::Detail::TIsResultType<T>::Value, "Coroutines must return FECResult or TECValueOrResult.");
+
+	using promise_type = Mgnc::Detail::TECCoroutinePromise<T>;
+
+	TECCoroutine(TECCoroutine&& Other)
+		: Handle(Other.Handle)
+	{
+		Other.Handle = nullptr;
+	}
+
+	TECCoroutine(const TECCoroutine&) = delete;
+	TECCoroutine& operator=(const TECCoroutine&) = delete;
+	TECCoroutine& operator=(TECCoroutine&&) = delete;
+
+	~TECCoroutine()
+	{
+		if (Handle)
+		{
+			Handle.destroy();
+		}
+	}
+
+	/**
+	 * Run the coroutine until it completes. It owns itself afterwards, and calls 'OnComplete' (if set) with its result
+	 * on whichever thread it finished on.
+	 */
+	void Start(TUniqueFunction<void(T)> OnComplete = nullptr) &&
+	{
+		check(Handle);
+		promise_type& Promise = Handle.promise();
+		Promise.OnComplete = MoveTemp(OnComplete);
+		Promise.bDetached = true;
+
+		const std::coroutine_handle<promise_type> Started = Handle;
+		Handle = nullptr;
+		Started.resume();
+	}
+
+private:
+	template<typename OtherT>
+	friend struct Mgnc::Detail::TECCoroutineAwaiter;
+	friend class Mgnc::Detail::TECCoroutinePromise<T>;
+
+	explicit TECCoroutine(std::coroutine_handle<promise_type> InHandle)
+		: Handle(InHandle)
+	{}
+
+	std::coroutine_handle<promise_type> Handle;
+};
+
+namespace Mgnc
+{
+/**
+ * Await to continue the coroutine on the game thread. Continues immediately if already on the game thread.
+ */
+inline auto ResumeOnGameThread()
+{
+	struct FAwaiter
+	{
+		bool await_ready() const { return IsInGameThread(); }
+		void await_suspend(std::coroutine_handle<> Handle)
+		{
+			AsyncTask(ENamedThreads::GameThread, [Handle]() { Handle.resume(); });
+		}
+		void await_resume() {}
+	};
+	return FAwaiter{};
+}
+
+/**
+ * Await to continue the coroutine on a task thread.
+ */
+inline auto ResumeOnTaskThread(UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::Normal)
+{
+	struct FAwaiter
+	{
+		UE::Tasks::ETaskPriority Priority;
+		bool await_ready() const { return false; }
+		void await_suspend(std::coroutine_handle<> Handle)
+		{
+			UE::Tasks::Launch(TEXT("Mgnc::ResumeOnTaskThread"), [Handle]() { Handle.resume(); }, Priority);
+		}
+		void await_resume() {}
+	};
+	return FAwaiter{Priority};
+}
+} // namespace Mgnc
+
+#endif // EC_WITH_COROUTINES
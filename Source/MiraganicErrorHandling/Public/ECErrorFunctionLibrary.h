@@ -6,7 +6,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ECPackedResults.h"
 #include "ECResult.h"
+#include "ECResultSwitchBinding.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 
 #include "ECErrorFunctionLibrary.generated.h"
@@ -35,7 +37,7 @@ public:
 	 * Create a result.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling", meta = (BlueprintThreadSafe, NativeMakeFunc))
-	static FECResult MakeResult(FECResult Result);
+	static FECResult MakeResult(const FECResult& Result);
 	
 	/**
 	 * Prints a result's message to the output log.
@@ -43,7 +45,7 @@ public:
 	 * @param Result Error to log.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ErrorHandling", DisplayName = "Log Result (Output Log)")
-	static void LogResultToOutputLog(EECLogVerbosity Verbosity, FECResult Result);
+	static void LogResultToOutputLog(EECLogVerbosity Verbosity, const FECResult& Result);
 
 	/**
 	 * Prints a result's message to the message log.
@@ -51,7 +53,7 @@ public:
 	 * @param Result Error to log.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ErrorHandling", DisplayName = "Log Result (Message Log)")
-	static void LogResultToMessageLog(EECLogVerbosity Verbosity, FECResult Result);
+	static void LogResultToMessageLog(EECLogVerbosity Verbosity, const FECResult& Result);
 
 	/**
 	 * Print a result's message to the output log if it's a failure.
@@ -59,7 +61,7 @@ public:
 	 * @param Result Result to log.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ErrorHandling", DisplayName = "Log If Failure (Output Log)")
-	static void LogResultToOutputLogIfFailure(EECLogVerbosity Verbosity, FECResult Result);
+	static void LogResultToOutputLogIfFailure(EECLogVerbosity Verbosity, const FECResult& Result);
 
 	/**
 	 * Print a result's message to the message log if it's a failure.
@@ -67,68 +69,121 @@ public:
 	 * @param Result Result to log.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ErrorHandling", DisplayName = "Log If Failure (Message Log)")
-	static void LogResultToMessageLogIfFailure(EECLogVerbosity Verbosity, FECResult Result);
+	static void LogResultToMessageLogIfFailure(EECLogVerbosity Verbosity, const FECResult& Result);
 
 	/**
 	 * Check if two results are equal.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling", DisplayName = "Equal (Result)", meta = (CompactNodeTitle = "==", BlueprintThreadSafe))
-	static bool Equal_ResultResult(FECResult A, FECResult B);
+	static bool Equal_ResultResult(const FECResult& A, const FECResult& B);
 
 	/**
 	 * Check if two results are not equal.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling", DisplayName = "Not Equal (Result)", meta = (CompactNodeTitle = "!=", BlueprintThreadSafe))
-	static bool NotEqual_ResultResult(FECResult A, FECResult B);
+	static bool NotEqual_ResultResult(const FECResult& A, const FECResult& B);
 
 	/**
 	 * Get the message for a result.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static FText GetMessage(FECResult Result);
+	static FText GetMessage(const FECResult& Result);
 
 	/**
 	 * Get the title for a result.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static FText GetTitle(FECResult Result);
+	static FText GetTitle(const FECResult& Result);
 
 	/**
 	 * Check if a result is a success (no error).
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static bool IsSuccess(FECResult Result);
+	static bool IsSuccess(const FECResult& Result);
 
 	/**
 	 * Check if a result is a failure (either a valid error or an invalid state).
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static bool IsFailure(FECResult Result);
+	static bool IsFailure(const FECResult& Result);
 
 	/**
 	 * Check if a result has a valid error (its category is valid and contains the result).
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static bool HasValidError(FECResult Result);
+	static bool HasValidError(const FECResult& Result);
 
 	/**
 	 * Check if a result is in a valid state (either IsSuccess or HasValidError).
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static bool IsValid(FECResult Result);
+	static bool IsValid(const FECResult& Result);
 
 	/**
 	 * Convert a result to a short string (Only Category and Title).
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling")
-	static FString ToShortString(FECResult Result);
+	static FString ToShortString(const FECResult& Result);
 
 	/**
 	 * Convert a result to a string (Category, Title, and Message).
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling", DisplayName = "To String (Result)",
 		meta = (BlueprintAutocast, Keywords = "cast convert", CompactNodeTitle = "->"))
-	static FString Conv_ErrorCodeToString(FECResult Result);
+	static FString Conv_ErrorCodeToString(const FECResult& Result);
+
+	/**
+	 * Count the failures in an array of results.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", meta = (BlueprintThreadSafe))
+	static int32 CountFailures(const TArray<FECResult>& Results);
+
+	/**
+	 * Get the first failure in an array of results, or 'Success' if there is none.
+	 * @param Index The failure's index, or -1 if there is none.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", meta = (BlueprintThreadSafe))
+	static FECResult FirstFailure(const TArray<FECResult>& Results, int32& Index);
+
+	/**
+	 * Check if every result in an array succeeded. True for an empty array.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", meta = (BlueprintThreadSafe))
+	static bool AllSucceeded(const TArray<FECResult>& Results);
+
+	/**
+	 * Get each distinct failure in an array of results, in order of first occurrence.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", meta = (BlueprintThreadSafe))
+	static TArray<FECResult> DistinctFailures(const TArray<FECResult>& Results);
+
+	/**
+	 * Print the failures in an array of results to the output log.
+	 * @param bDeduplicate Print each distinct failure once, with the number of times it occurred.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling|Batch", DisplayName = "Log Failures (Output Log)")
+	static void LogFailures(EECLogVerbosity Verbosity, const TArray<FECResult>& Results, bool bDeduplicate = true);
+
+	/**
+	 * Pack an array of results, which makes the other batch functions cheaper for large arrays with few distinct results.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", meta = (BlueprintThreadSafe))
+	static FECPackedResults PackResults(const TArray<FECResult>& Results);
+
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", DisplayName = "Count Failures (Packed)", meta = (BlueprintThreadSafe))
+	static int32 CountFailures_Packed(const FECPackedResults& Results);
+
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", DisplayName = "First Failure (Packed)", meta = (BlueprintThreadSafe))
+	static FECResult FirstFailure_Packed(const FECPackedResults& Results, int32& Index);
+
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", DisplayName = "All Succeeded (Packed)", meta = (BlueprintThreadSafe))
+	static bool AllSucceeded_Packed(const FECPackedResults& Results);
+
+	UFUNCTION(BlueprintPure, Category = "ErrorHandling|Batch", DisplayName = "Distinct Failures (Packed)", meta = (BlueprintThreadSafe))
+	static TArray<FECResult> DistinctFailures_Packed(const FECPackedResults& Results);
+
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling|Batch", DisplayName = "Log Failures (Packed, Output Log)")
+	static void LogFailures_Packed(EECLogVerbosity Verbosity, const FECPackedResults& Results, bool bDeduplicate = true);
 
 	/**
 	 * Construct a result from an enum and its value. Note that this can return invalid Results.
@@ -139,7 +194,30 @@ public:
 	 * Valid Enum  , Value >  0: Some user-defined error
 	 * Invalid Enum, Value == 0: Success, but print runtime warning (Enum input was invalid)
 	 * Invalid Enum, Value >  0: Invalid, print runtime warning (Enum input was invalid)
+	 *
+	 * Only called for linked inputs, which are always bytes in Blueprint: the 'Enum to Result' node folds literal
+	 * values (including int64 ones) at compile time.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ErrorHandling", meta = (BlueprintInternalUseOnly = true))
 	static FECResult EnumToResult(const UEnum* Enum, uint8 EnumValue);
+
+	/**
+	 * Get the output a compiled 'Switch on Result' node should take (see FECResultSwitchTable::FindOutputIndex). Cases
+	 * are looked up in the table baked into the Blueprint class which owns the calling function (see
+	 * UECResultSwitchBinding), which is why this needs a custom thunk.
+	 * @param DefaultIndex Output to take if the table is missing.
+	 */
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "ErrorHandling", meta = (BlueprintInternalUseOnly = true))
+	static FECResultSwitchOutput GetSwitchResultOutput(const FECResult& Selection, int32 TableKey, int32 DefaultIndex);
+
+	/**
+	 * Pure version of GetSwitchResultOutput, for 'Select on Result' nodes.
+	 * @param DefaultIndex Index of the node's 'Default' option, taken if the table is missing.
+	 */
+	UFUNCTION(BlueprintPure, CustomThunk, Category = "ErrorHandling", meta = (BlueprintInternalUseOnly = true))
+	static int32 GetSelectResultOptionIndex(const FECResult& Selection, int32 TableKey, int32 DefaultIndex);
+
+private:
+	DECLARE_FUNCTION(execGetSwitchResultOutput);
+	DECLARE_FUNCTION(execGetSelectResultOptionIndex);
 };
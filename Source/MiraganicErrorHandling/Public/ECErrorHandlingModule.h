@@ -13,4 +13,7 @@ class FECErrorHandlingModule : public IModuleInterface
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+	TSharedPtr<class FECMetricsExporter> MetricsExporter;
 };
@@ -6,8 +6,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ECFailureReporting.h"
 #include "ECLogging.h"
+#include "ECMessageArgs.h"
+#include "ECMessageFormat.h"
 #include "ECResult.h"
+#include "ECStats.h"
+#include "ECValueOrResult.h"
 
 /** Needed to force macro expansion on MSVC. */
 #define EC_EXPAND(X) X
@@ -26,21 +31,63 @@
 /** Generate a compile-time unique identifier for a variable. */
 #define EC_UNIQUE_NAME EC_CONCAT(_Temp, __COUNTER__)
 
+/** Mark a function as rarely called, so compilers place it away from hot code. */
+#if defined(__clang__) || defined(__GNUC__)
+#define EC_COLD __attribute__((cold))
+#else
+#define EC_COLD
+#endif
+
+namespace Mgnc::Detail
+{
+// Convert a value to a loggable result, keeping message arguments if it has them.
+template<typename T>
+FECResult MakeLoggableResult(const T& Value)
+{
+	return FECResult(Value);
+}
+
+inline FECResultWithArgs MakeLoggableResult(const FECResultWithArgs& Result)
+{
+	return Result;
+}
+
+// Log and report a failure caught by EC_VALIDATE_OR_LOG. Kept out of line so call sites only contain a branch and call.
+EC_COLD MIRAGANICERRORHANDLING_API FORCENOINLINE void LogValidationFailure(const TCHAR* FunctionName, const FECResult& Result);
+EC_COLD MIRAGANICERRORHANDLING_API FORCENOINLINE void LogValidationFailure(const TCHAR* FunctionName, const FECResultWithArgs& Result);
+} // namespace Mgnc::Detail
+
 /**
- * Log the current function name and an error code enum's message.
+ * Log the current function name and an error code enum's message. Failures are also reported to Mgnc::ReportFailure.
+ * Message arguments carried by FECResultWithArgs are formatted into the message.
  */
 #define EC_LOG_RESULT(LogCategory, Verbosity, Enum) \
-	UE_LOG(LogCategory, Verbosity, TEXT("%s: %s"), EC_FUNCNAME, *FECResult(Enum).ToString());
+	do \
+	{ \
+		SCOPE_CYCLE_COUNTER(STAT_ECLogResult); \
+		CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult); \
+		const auto _EC_LoggedResult = Mgnc::Detail::MakeLoggableResult(Enum); \
+		UE_LOG(LogCategory, Verbosity, TEXT("%s: %s"), EC_FUNCNAME, *_EC_LoggedResult.ToString()); \
+		Mgnc::ReportFailure(_EC_LoggedResult); \
+	} while (false);
 
 /**
- * Log the current function name and use the result's message as the formatting string.
+ * Log the current function name and use the result's message as the formatting string. The message is parsed once
+ * per result and cached (see FECMessageFormatCache).
  */
 #define EC_LOG_RESULT_FMT(LogCategory, Verbosity, Enum, ...) \
-UE_LOG(LogCategory, Verbosity, TEXT("%s: %s"), EC_FUNCNAME, *FString::Format(*FECResult(Enum).GetMessage().ToString(), {##__VA_ARGS__}));
+	do \
+	{ \
+		SCOPE_CYCLE_COUNTER(STAT_ECLogResult); \
+		CSV_SCOPED_TIMING_STAT(ErrorHandling, LogResult); \
+		const FECResult _EC_LoggedResult(Enum); \
+		UE_LOG(LogCategory, Verbosity, TEXT("%s: %s"), EC_FUNCNAME, *Mgnc::FormatResultMessage(_EC_LoggedResult, {##__VA_ARGS__})); \
+		Mgnc::ReportFailure(_EC_LoggedResult); \
+	} while (false);
 
 #define _EC_VALIDATE_IMPL(TempName, Expr) \
 	auto TempName = Expr; \
-	if (TempName.IsFailure()) \
+	if (UNLIKELY(TempName.IsFailure())) \
 	{ \
 		return TempName; \
 	}
@@ -53,9 +100,9 @@ UE_LOG(LogCategory, Verbosity, TEXT("%s: %s"), EC_FUNCNAME, *FString::Format(*FE
 
 #define _EC_VALIDATE_LOG_IMPL(TempName, Expr, Else) \
 	auto TempName = Expr; \
-	if (TempName.IsFailure()) \
+	if (UNLIKELY(TempName.IsFailure())) \
 	{ \
-		EC_LOG_RESULT(LogErrorHandling, Error, TempName); \
+		Mgnc::Detail::LogValidationFailure(EC_FUNCNAME, TempName); \
 		Else; \
 	}
 /**
@@ -64,3 +111,21 @@ UE_LOG(LogCategory, Verbosity, TEXT("%s: %s"), EC_FUNCNAME, *FString::Format(*FE
  */
 #define EC_VALIDATE_OR_LOG(Expr, Else) \
 	EC_EXPAND(_EC_VALIDATE_LOG_IMPL(EC_UNIQUE_NAME, Expr, Else))
+
+#define _EC_TRY_ASSIGN_IMPL(TempName, Lhs, Expr) \
+	auto TempName = Expr; \
+	if (UNLIKELY(TempName.IsFailure())) \
+	{ \
+		return TempName.GetResult(); \
+	} \
+	Lhs = TempName.StealValue();
+/**
+ * Evaluate 'Expr', which returns a TECValueOrResult. If it succeeded, move its value into 'Lhs' (which can be a
+ * declaration). Else, return its failure.
+ *
+ * E.g.,:
+ *
+ * EC_TRY_ASSIGN(const FInventorySlot Slot, FindFreeSlot(Inventory));
+ */
+#define EC_TRY_ASSIGN(Lhs, Expr) \
+	EC_EXPAND(_EC_TRY_ASSIGN_IMPL(EC_UNIQUE_NAME, Lhs, Expr))
@@ -0,0 +1,101 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECFailureRateMonitor.generated.h"
+
+/**
+ * A threshold on how often a result (or any result from a category) may fail.
+ */
+USTRUCT(BlueprintType)
+struct MIRAGANICERRORHANDLING_API FECFailureRateAlarm
+{
+	GENERATED_BODY()
+
+	// Result to watch. If 'bMatchWholeCategory' is set, any failure from this result's category is counted.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error")
+	FECResult Result;
+
+	// Count every failure from the result's category instead of only the exact result.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error")
+	bool bMatchWholeCategory = false;
+
+	// The alarm triggers when the failure rate over the window exceeds this many failures per second.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "0"))
+	float MaxFailuresPerSecond = 100.f;
+
+	// Length of the sliding window the rate is measured over.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "0.1", Units = "s"))
+	float WindowSeconds = 1.f;
+
+	// Also record a CSV profiler event when the alarm triggers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error")
+	bool bEmitCsvEvent = true;
+
+	// Also record an Unreal Insights bookmark when the alarm triggers.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error")
+	bool bEmitTraceBookmark = true;
+};
+
+/**
+ * An alarm which crossed its threshold.
+ */
+struct FECFailureRateAlarmEvent
+{
+	int32 AlarmId = INDEX_NONE;
+	FECFailureRateAlarm Alarm;
+	float FailuresPerSecond = 0.f;
+};
+
+/**
+ * Tracks sliding-window failure rates for a set of alarms. Each alarm's window is split into fixed buckets, so a
+ * failure costs one map lookup plus at most 'NumBuckets' bucket resets. Thread-safe.
+ *
+ * Alarms trigger once when their rate crosses the threshold, and re-arm once the rate falls back below it.
+ */
+class MIRAGANICERRORHANDLING_API FECFailureRateMonitor
+{
+public:
+	static FECFailureRateMonitor& Get();
+
+	// Add an alarm and return its id. Ids are never reused, so removing a stale id is a no-op.
+	int32 AddAlarm(const FECFailureRateAlarm& Alarm);
+	void RemoveAlarm(int32 AlarmId);
+	void RemoveAllAlarms();
+
+	// Count a failure against every alarm watching it.
+	void RecordFailure(const FECResult& Result);
+
+	// Re-arm alarms whose rate dropped, and move triggered alarms to 'OutEvents'.
+	void ConsumeEvents(TArray<FECFailureRateAlarmEvent>& OutEvents);
+
+private:
+	static constexpr int32 NumBuckets = 10;
+
+	struct FWindow
+	{
+		FECFailureRateAlarm Alarm;
+		double BucketSeconds = 0.1;
+		int64 HeadBucket = 0;
+		int32 Buckets[NumBuckets] = {};
+		int32 Sum = 0;
+		bool bTriggered = false;
+		bool bPendingEvent = false;
+
+		// Drop buckets which fell out of the window.
+		void Advance(double Now);
+		float GetRate() const;
+	};
+
+	FCriticalSection Lock;
+	TMap<int32, FWindow> Windows;
+	int32 NextAlarmId = 0;
+	TMultiMap<FECResult, int32> ResultAlarms;
+	TMultiMap<const UEnum*, int32> CategoryAlarms;
+	std::atomic<int32> NumAlarms{0};
+};
@@ -0,0 +1,67 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+
+/**
+ * A point-in-time copy of a single failure counter. Names are resolved when the counter is created, so snapshots can
+ * be read on any thread.
+ */
+struct MIRAGANICERRORHANDLING_API FECFailureCountSnapshot
+{
+	// Name of the result's category, or 'Invalid' for results without a valid category.
+	FString CategoryName;
+	// Name of the result's code within its category.
+	FString CodeName;
+	// Total number of failures reported since startup.
+	uint64 Count = 0;
+};
+
+/**
+ * Thread-safe counters for every failing result reported through Mgnc::ReportFailure.
+ */
+class MIRAGANICERRORHANDLING_API FECFailureCounters
+{
+public:
+	static FECFailureCounters& Get();
+
+	// Increment the counter for a failing result. Successes are ignored.
+	void Increment(const FECResult& Result);
+
+	// Get the number of times a result was reported.
+	uint64 GetCount(const FECResult& Result) const;
+
+	// Copy all counters. Order is non-deterministic.
+	void Snapshot(TArray<FECFailureCountSnapshot>& OutCounts) const;
+
+	// Reset all counters to zero.
+	void Reset();
+
+private:
+	struct FCounter
+	{
+		FString CategoryName;
+		FString CodeName;
+		std::atomic<uint64> Count{0};
+	};
+
+	mutable FRWLock Lock;
+	TMap<FECResult, TUniquePtr<FCounter>> Counters;
+};
+
+namespace Mgnc
+{
+/**
+ * Report that a failure occurred. This feeds the plugin's runtime diagnostics (failure counters, metrics export, failure
+ * rate alarms, callstack sampling, stats and CSV profiler counts).
+ *
+ * Results logged through the plugin's logging macros and Blueprint functions are reported automatically. Call this
+ * directly for failures which are handled without being logged. Safe to call from any thread.
+ */
+MIRAGANICERRORHANDLING_API void ReportFailure(const FECResult& Result);
+} // namespace Mgnc
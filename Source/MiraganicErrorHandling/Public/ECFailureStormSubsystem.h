@@ -0,0 +1,65 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ECFailureRateMonitor.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "ECFailureStormSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FECOnFailureStormDynamic, const FECFailureRateAlarm&, Alarm,
+	float, FailuresPerSecond);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FECOnFailureStorm, const FECFailureRateAlarm&, float);
+
+/**
+ * Raises events when results fail more often than their configured rate (E.g., more than 100 'SpawnCollisionBlocked'
+ * per second). Alarms can be configured in the [/Script/MiraganicErrorHandling.ECFailureStormSubsystem] section of
+ * the game config, or added at runtime.
+ *
+ * Failures are counted through Mgnc::ReportFailure. Events are broadcast on the game thread.
+ */
+UCLASS(Config = Game)
+class MIRAGANICERRORHANDLING_API UECFailureStormSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Start watching a result's failure rate.
+	 * @return Id of the alarm, for use with RemoveAlarm.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling")
+	int32 AddAlarm(const FECFailureRateAlarm& Alarm);
+
+	/**
+	 * Stop watching a failure rate.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ErrorHandling")
+	void RemoveAlarm(int32 AlarmId);
+
+	// Broadcast when an alarm's failure rate crosses its threshold.
+	UPROPERTY(BlueprintAssignable, Category = "ErrorHandling")
+	FECOnFailureStormDynamic OnFailureStorm;
+
+	// Native version of OnFailureStorm.
+	FECOnFailureStorm OnFailureStormNative;
+
+protected:
+	// Alarms added when the subsystem is initialized.
+	UPROPERTY(Config, EditAnywhere, Category = "ErrorHandling")
+	TArray<FECFailureRateAlarm> Alarms;
+
+private:
+	bool Tick(float DeltaTime);
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	// Alarms added through this subsystem, configured or at runtime. Removed from the monitor in Deinitialize.
+	TSet<int32> AlarmIds;
+};
@@ -0,0 +1,77 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECErrorMacros.h"
+#include "ECResult.h"
+#include "ECLastResult.generated.h"
+
+/**
+ * Errors for functions which report failure through a bool.
+ */
+UENUM(meta = (ErrorCategory))
+enum class EECLastResult : int64
+{
+	Success = 0,
+	// The function failed without saying why.
+	UnknownFailure,
+};
+
+/**
+ * A per-thread "last result" slot, so functions which return bool can say why they failed without changing their
+ * signature. The failing function calls SetLastResult, and its caller calls ConsumeLastResult (or uses
+ * EC_VALIDATE_BOOL).
+ *
+ * E.g.,:
+ *
+ * bool AddItem(FInventory& Inventory, const FItem& Item)
+ * {
+ *     if (Inventory.IsFull())
+ *     {
+ *         Mgnc::SetLastResult(EInventoryResult::Full);
+ *         return false;
+ *     }
+ *     ...
+ * }
+ *
+ * FECResult GiveReward(...)
+ * {
+ *     EC_VALIDATE_BOOL(AddItem(Inventory, Reward));
+ *     ...
+ * }
+ */
+namespace Mgnc
+{
+// Store a result for the current thread, replacing any result which wasn't consumed.
+MIRAGANICERRORHANDLING_API void SetLastResult(const FECResult& Result);
+
+// Get and clear the current thread's last result. Returns 'Fallback' if no failure was set.
+MIRAGANICERRORHANDLING_API FECResult ConsumeLastResult(const FECResult& Fallback = EECLastResult::UnknownFailure);
+
+// Clear the current thread's last result.
+MIRAGANICERRORHANDLING_API void ResetLastResult();
+} // namespace Mgnc
+
+#define _EC_VALIDATE_BOOL_IMPL(Expr, Fallback) \
+	Mgnc::ResetLastResult(); \
+	if (UNLIKELY(!(Expr))) \
+	{ \
+		return Mgnc::ConsumeLastResult(Fallback); \
+	}
+
+/**
+ * If the bool 'Expr' is true, continue execution. Else, return the result it stored with Mgnc::SetLastResult, or
+ * 'UnknownFailure' if it didn't store one.
+ */
+#define EC_VALIDATE_BOOL(Expr) \
+	EC_EXPAND(_EC_VALIDATE_BOOL_IMPL(Expr, EECLastResult::UnknownFailure))
+
+/**
+ * The same as EC_VALIDATE_BOOL, but returns 'Fallback' if 'Expr' didn't store a result.
+ */
+#define EC_VALIDATE_BOOL_OR(Expr, Fallback) \
+	EC_EXPAND(_EC_VALIDATE_BOOL_IMPL(Expr, Fallback))
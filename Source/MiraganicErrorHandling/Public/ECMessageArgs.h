@@ -0,0 +1,127 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+
+/**
+ * A small, fixed-size buffer of typed message arguments (integers, floats and names). Arguments are stored inline and
+ * only converted to strings when a message is formatted, so creating them never allocates.
+ */
+class MIRAGANICERRORHANDLING_API FECMessageArgs
+{
+public:
+	static constexpr int32 MaxArgs = 4;
+
+	FECMessageArgs() = default;
+
+	template<typename... ArgTs>
+	explicit FECMessageArgs(ArgTs... InArgs)
+	{
+		static_assert(sizeof...(ArgTs) <= MaxArgs, "Too many message arguments.");
+		(Add(InArgs), ...);
+	}
+
+	template<typename T>
+	typename TEnableIf<TIsIntegral<T>::Value>::Type Add(T Value)
+	{
+		AddInt(static_cast<int64>(Value));
+	}
+
+	template<typename T>
+	typename TEnableIf<TIsFloatingPoint<T>::Value>::Type Add(T Value)
+	{
+		AddDouble(static_cast<double>(Value));
+	}
+
+	void Add(FName Value);
+
+	int32 Num() const { return NumArgs; }
+	bool IsEmpty() const { return NumArgs == 0; }
+
+	// Convert the arguments for use with FString::Format-style templates.
+	void ToFormatArgs(TArray<FStringFormatArg, TInlineAllocator<MaxArgs>>& OutArgs) const;
+
+private:
+	enum class EType : uint8
+	{
+		Int,
+		Double,
+		Name,
+	};
+
+	void AddInt(int64 Value);
+	void AddDouble(double Value);
+	bool CanAdd() const;
+
+	// Raw argument storage; interpreted according to 'Types'.
+	uint64 Payloads[MaxArgs];
+	EType Types[MaxArgs];
+	uint8 NumArgs = 0;
+};
+
+/**
+ * A result which carries arguments for its message. The message is used as a template ('{0}', '{1}', ...), and the
+ * arguments are only formatted when the message is requested or logged.
+ *
+ * E.g.,:
+ *
+ * FECResultWithArgs DepositItems(...)
+ * {
+ *     if (Stack.IsFull())
+ *     {
+ *         // Message: "Can't deposit {1} because the item stack is full ({0} items)."
+ *         return FECResultWithArgs(EInventoryResult::StackFull, Stack.Num(), Item.GetFName());
+ *     }
+ *     return EInventoryResult::Success;
+ * }
+ *
+ * Converts implicitly to FECResult, which drops the arguments.
+ */
+struct MIRAGANICERRORHANDLING_API FECResultWithArgs
+{
+	FECResultWithArgs() = default;
+
+	FECResultWithArgs(const FECResult& InResult)
+		: Result(InResult)
+	{}
+
+	template<typename T, typename = typename TEnableIf<TIsEnumClass<T>::Value || TIsEnum<T>::Value>::Type>
+	FECResultWithArgs(T InEnum)
+		: Result(InEnum)
+	{}
+
+	template<typename ArgT, typename... ArgTs>
+	FECResultWithArgs(const FECResult& InResult, ArgT InArg, ArgTs... InArgs)
+		: Result(InResult)
+		, Args(InArg, InArgs...)
+	{}
+
+	operator const FECResult&() const { return Result; }
+
+	bool IsSuccess() const { return Result.IsSuccess(); }
+	bool IsFailure() const { return Result.IsFailure(); }
+
+	const FECResult& GetResult() const { return Result; }
+	const FECMessageArgs& GetArgs() const { return Args; }
+
+	// Format this result's category, title, and message (with arguments) as text.
+	FText GetFormattedMessage() const;
+	// Get this result's message with arguments substituted.
+	FText GetMessage() const;
+	// Format this result's category, title, and message (with arguments) as a string.
+	FString ToString() const;
+
+	FORCEINLINE bool operator==(const FECResult& Other) const { return Result == Other; }
+	FORCEINLINE bool operator!=(const FECResult& Other) const { return Result != Other; }
+
+private:
+	FString FormatMessage() const;
+
+	FECResult Result;
+	FECMessageArgs Args;
+};
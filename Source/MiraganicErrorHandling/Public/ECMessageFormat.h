@@ -0,0 +1,89 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "Misc/StringBuilder.h"
+
+/**
+ * A message template parsed once into literal segments and argument slots. Uses the same syntax as FString::Format
+ * with ordered arguments: '{0}' is replaced by the first argument, and '`' escapes the following brace.
+ */
+class MIRAGANICERRORHANDLING_API FECCompiledMessageFormat
+{
+public:
+	static FECCompiledMessageFormat Compile(FStringView Pattern);
+
+	// Substitute arguments into the template. Out-of-range arguments are left as written (E.g., '{3}').
+	void AppendTo(FStringBuilderBase& Out, TArrayView<const FStringFormatArg> Args) const;
+
+	int32 GetNumSegments() const { return Segments.Num(); }
+
+private:
+	struct FSegment
+	{
+		// Range in 'Literals' to copy; used for literal segments and for out-of-range arguments.
+		int32 LiteralStart = 0;
+		int32 LiteralLen = 0;
+		// Index of the argument to substitute, or INDEX_NONE for a literal segment.
+		int32 ArgIndex = INDEX_NONE;
+	};
+
+	// All literal text in the template, stored contiguously.
+	FString Literals;
+	TArray<FSegment> Segments;
+};
+
+/**
+ * Caches compiled message templates per result. Entries are invalidated when a category changes in the editor, when
+ * the culture changes, or when the category object is destroyed.
+ */
+class MIRAGANICERRORHANDLING_API FECMessageFormatCache
+{
+public:
+	static FECMessageFormatCache& Get();
+
+	// Get the compiled template for a result's message, compiling it on first use.
+	TSharedRef<const FECCompiledMessageFormat, ESPMode::ThreadSafe> FindOrCompile(const FECResult& Result);
+
+	// Drop all templates belonging to a category.
+	void Invalidate(const UEnum& Category);
+
+	// Drop all templates.
+	void Reset();
+
+private:
+	FECMessageFormatCache();
+
+	struct FEntry
+	{
+		// Detects a different category allocated at the same address as a destroyed one.
+		TWeakObjectPtr<const UEnum> Category;
+		TSharedRef<const FECCompiledMessageFormat, ESPMode::ThreadSafe> Format;
+	};
+
+	FRWLock Lock;
+	TMap<FECResult, FEntry> Entries;
+};
+
+namespace Mgnc
+{
+/**
+ * Append a result's message to a string builder, using it as a template for ordered arguments.
+ */
+MIRAGANICERRORHANDLING_API void AppendFormattedResultMessage(FStringBuilderBase& Out,
+	const FECResult& Result,
+	TArrayView<const FStringFormatArg> Args
+);
+
+/**
+ * Format a result's message, using it as a template for ordered arguments.
+ */
+MIRAGANICERRORHANDLING_API FString FormatResultMessage(const FECResult& Result,
+	TArrayView<const FStringFormatArg> Args
+);
+} // namespace Mgnc
@@ -0,0 +1,70 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECPackedResults.generated.h"
+
+/**
+ * Errors from packing results.
+ */
+UENUM(meta = (ErrorCategory))
+enum class EECPackedResultsError : int64
+{
+	Success = 0,
+	// The packed array already held as many distinct results as its 2 byte indices can address.
+	TooManyDistinctResults,
+};
+
+/**
+ * A compact array of results. Each element is a 2 byte index into a table of the distinct results in the array, which
+ * suits large batches where most elements share a handful of results.
+ *
+ * The table is in order of first occurrence, and its first entry is always 'Success'.
+ */
+USTRUCT(BlueprintType)
+struct MIRAGANICERRORHANDLING_API FECPackedResults
+{
+	GENERATED_BODY()
+
+public:
+	FECPackedResults();
+
+	// Append a result. Once the table is full, further distinct results are stored as 'TooManyDistinctResults'.
+	void Add(const FECResult& Result);
+	void Reserve(int32 Number);
+	void Reset();
+
+	int32 Num() const { return Indices.Num(); }
+	bool IsEmpty() const { return Indices.IsEmpty(); }
+
+	FECResult operator[](int32 Index) const { return Table[Indices[Index]]; }
+
+	// Check if every result succeeded.
+	bool AllSucceeded() const;
+	// Get the index of the first failing result, or INDEX_NONE if all succeeded.
+	int32 FindFirstFailure() const;
+	// Count the failing results.
+	int32 CountFailures() const;
+	// Get each distinct failure, in order of first occurrence.
+	TArray<FECResult> GetDistinctFailures() const;
+	// Get the table of distinct results. Index 0 is 'Success'.
+	const TArray<FECResult>& GetTable() const { return Table; }
+	// Get the table index of every result.
+	const TArray<uint16>& GetIndices() const { return Indices; }
+
+private:
+	// Distinct results. Index 0 is 'Success'.
+	UPROPERTY()
+	TArray<FECResult> Table;
+
+	UPROPERTY()
+	TArray<uint16> Indices;
+
+	// Table index of each distinct result. Not serialized, so it's rebuilt whenever it's out of step with 'Table'.
+	TMap<FECResult, uint16> TableLookup;
+};
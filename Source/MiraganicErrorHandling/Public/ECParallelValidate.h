@@ -0,0 +1,131 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "ECCancellation.h"
+#include "ECPackedResults.h"
+#include "ECResult.h"
+
+enum class EECParallelValidateFlags : uint8
+{
+	None = 0,
+	// Stop validating once an element fails. The output ends at the first failing element.
+	StopAtFirstFailure = 1 << 0,
+	// Validate on the calling thread.
+	ForceSingleThread = 1 << 1,
+};
+ENUM_CLASS_FLAGS(EECParallelValidateFlags);
+
+namespace Mgnc
+{
+namespace Detail
+{
+// Get how many chunks to split a batch into: enough to balance across workers, but large enough to amortize scheduling.
+MIRAGANICERRORHANDLING_API int32 GetParallelValidateNumChunks(int32 NumElements);
+} // namespace Detail
+
+/**
+ * Validate every element with 'Predicate' (signature: (const ElementT&) -> FECResult) on worker threads, returning the
+ * result for each element. 'Predicate' must be safe to call concurrently.
+ *
+ * With 'StopAtFirstFailure', workers stop picking up elements past the earliest failure found so far. The output
+ * contains the results up to and including the first failing element, so it's the same for any number of threads.
+ *
+ * Elements which weren't validated before 'Cancellation' was cancelled get 'Cancelled' results.
+ *
+ * E.g.,:
+ *
+ * const FECPackedResults Results = Mgnc::ParallelValidate(Recipes, [&](const FRecipe& Recipe) -> FECResult
+ * {
+ *     return CanCraft(Inventory, Recipe);
+ * });
+ */
+template<typename ElementT, typename PredicateT>
+FECPackedResults ParallelValidate(
+	TArrayView<const ElementT> Elements,
+	PredicateT&& Predicate,
+	EECParallelValidateFlags Flags = EECParallelValidateFlags::None,
+	const FECCancellationToken& Cancellation = FECCancellationToken())
+{
+	const int32 NumElements = Elements.Num();
+	const bool bStopAtFirstFailure = EnumHasAnyFlags(Flags, EECParallelValidateFlags::StopAtFirstFailure);
+	const int32 NumChunks = Detail::GetParallelValidateNumChunks(NumElements);
+	const int32 ChunkSize = FMath::DivideAndRoundUp(NumElements, NumChunks);
+
+	TArray<FECResult> Results;
+	Results.SetNum(NumElements);
+	std::atomic<int32> FirstFailure{MAX_int32};
+
+	ParallelFor(
+		TEXT("Mgnc::ParallelValidate"),
+		NumChunks,
+		1,
+		[&](int32 ChunkIdx)
+		{
+			const int32 End = FMath::Min((ChunkIdx + 1) * ChunkSize, NumElements);
+			for (int32 Idx = ChunkIdx * ChunkSize; Idx < End; ++Idx)
+			{
+				// Elements before the earliest failure are always validated, which keeps the output deterministic.
+				if (bStopAtFirstFailure && Idx > FirstFailure.load(std::memory_order_relaxed))
+				{
+					return;
+				}
+
+				Results[Idx] = Cancellation.IsCancellationRequested()
+					? FECResult(EECOperationResult::Cancelled)
+					: FECResult(Invoke(Predicate, Elements[Idx]));
+				if (bStopAtFirstFailure && Results[Idx].IsFailure())
+				{
+					int32 Current = FirstFailure.load(std::memory_order_relaxed);
+					while (Idx < Current && !FirstFailure.compare_exchange_weak(Current, Idx, std::memory_order_relaxed))
+					{
+					}
+					return;
+				}
+			}
+		},
+		EnumHasAnyFlags(Flags, EECParallelValidateFlags::ForceSingleThread)
+			? EParallelForFlags::ForceSingleThread
+			: EParallelForFlags::None);
+
+	const int32 NumOutputs = bStopAtFirstFailure
+		? FMath::Min(NumElements, FirstFailure.load(std::memory_order_relaxed) + 1)
+		: NumElements;
+	FECPackedResults Packed;
+	Packed.Reserve(NumOutputs);
+	for (int32 Idx = 0; Idx < NumOutputs; ++Idx)
+	{
+		Packed.Add(Results[Idx]);
+	}
+	return Packed;
+}
+
+template<typename ElementT, typename AllocatorT, typename PredicateT>
+FECPackedResults ParallelValidate(
+	const TArray<ElementT, AllocatorT>& Elements,
+	PredicateT&& Predicate,
+	EECParallelValidateFlags Flags = EECParallelValidateFlags::None,
+	const FECCancellationToken& Cancellation = FECCancellationToken())
+{
+	return ParallelValidate(TArrayView<const ElementT>(Elements), Forward<PredicateT>(Predicate), Flags, Cancellation);
+}
+
+/**
+ * Validate every element in parallel, and get each distinct failure in order of first occurrence. Empty if every
+ * element succeeded.
+ */
+template<typename ElementT, typename AllocatorT, typename PredicateT>
+TArray<FECResult> ParallelValidateDistinct(
+	const TArray<ElementT, AllocatorT>& Elements,
+	PredicateT&& Predicate,
+	EECParallelValidateFlags Flags = EECParallelValidateFlags::None,
+	const FECCancellationToken& Cancellation = FECCancellationToken())
+{
+	return ParallelValidate(Elements, Forward<PredicateT>(Predicate), Flags, Cancellation).GetDistinctFailures();
+}
+} // namespace Mgnc
@@ -0,0 +1,59 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/MpscQueue.h"
+#include "ECResult.h"
+#include "ECResultMailbox.generated.h"
+
+/**
+ * A result posted from another thread, with optional context for the game thread to react to it.
+ */
+USTRUCT(BlueprintType)
+struct MIRAGANICERRORHANDLING_API FECPostedResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	FECResult Result;
+
+	// Object the result relates to (E.g., the actor a path was requested for). Null if it was destroyed.
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	TWeakObjectPtr<UObject> Context;
+
+	// Caller-defined id of the operation (E.g., a request or load handle).
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	int64 Handle = 0;
+};
+
+/**
+ * A lock-free queue of results posted from any thread, drained in batches on the game thread by
+ * UECResultMailboxSubsystem. Use this instead of an AsyncTask to the game thread per result.
+ */
+class MIRAGANICERRORHANDLING_API FECResultMailbox
+{
+public:
+	static FECResultMailbox& Get();
+
+	// Post a result. Safe to call from any thread.
+	void Post(const FECResult& Result, UObject* Context = nullptr, int64 Handle = 0);
+
+	// Move up to 'MaxResults' posted results into 'OutResults', in the order they were posted. Must only be called from
+	// a single thread. Returns the number of results moved.
+	int32 Drain(TArray<FECPostedResult>& OutResults, int32 MaxResults);
+
+private:
+	TMpscQueue<FECPostedResult> Queue;
+};
+
+namespace Mgnc
+{
+/**
+ * Post a result to be handled on the game thread (see UECResultMailboxSubsystem). Safe to call from any thread.
+ */
+MIRAGANICERRORHANDLING_API void PostResultToGameThread(const FECResult& Result, UObject* Context = nullptr, int64 Handle = 0);
+} // namespace Mgnc
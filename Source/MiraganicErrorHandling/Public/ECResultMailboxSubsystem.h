@@ -0,0 +1,48 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ECResultMailbox.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "ECResultMailboxSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FECOnResultPostedDynamic, const FECPostedResult&, Posted);
+DECLARE_MULTICAST_DELEGATE_OneParam(FECOnResultPosted, const FECPostedResult&);
+
+/**
+ * Dispatches results posted with Mgnc::PostResultToGameThread. The mailbox is drained once per tick, up to
+ * 'ec.Mailbox.MaxPerTick' results; the rest are dispatched on following ticks.
+ */
+UCLASS()
+class MIRAGANICERRORHANDLING_API UECResultMailboxSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Get the delegate broadcast for posted results from a category.
+	FECOnResultPosted& OnCategoryResultPosted(const UEnum& Category);
+
+	// Broadcast for every posted result.
+	UPROPERTY(BlueprintAssignable, Category = "ErrorHandling")
+	FECOnResultPostedDynamic OnResultPosted;
+
+	// Native version of OnResultPosted.
+	FECOnResultPosted OnResultPostedNative;
+
+private:
+	bool Tick(float DeltaTime);
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	// Delegates are heap allocated so listeners can add categories while another category is broadcasting.
+	TMap<const UEnum*, TUniquePtr<FECOnResultPosted>> CategoryDelegates;
+	// Reused between ticks to avoid reallocating.
+	TArray<FECPostedResult> Batch;
+};
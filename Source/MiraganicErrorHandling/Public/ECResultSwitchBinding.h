@@ -0,0 +1,186 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "Engine/DynamicBlueprintBinding.h"
+#include "ECResultSwitchBinding.generated.h"
+
+/**
+ * A named set of results which a 'Switch on Result' node routes to a single output.
+ */
+USTRUCT()
+struct MIRAGANICERRORHANDLING_API FECResultSwitchGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Error")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, Category = "Error")
+	TArray<FECResult> Results;
+};
+
+/**
+ * The output a compiled 'Switch on Result' node takes. The node branches on the bits directly, so reaching an output
+ * costs one native call and then only VM jumps.
+ */
+USTRUCT(BlueprintType, meta = (BlueprintInternalUseOnly = "true"))
+struct MIRAGANICERRORHANDLING_API FECResultSwitchOutput
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxBits = 16;
+
+	FECResultSwitchOutput() = default;
+	explicit FECResultSwitchOutput(int32 InIndex);
+
+	// Get the name of the member holding a bit of the index.
+	static FName GetBitMemberName(int32 Bit);
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	int32 Index = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit0 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit1 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit2 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit3 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit4 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit5 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit6 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit7 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit8 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit9 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit10 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit11 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit12 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit13 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit14 = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Error")
+	bool bBit15 = false;
+};
+
+/**
+ * The cases of one 'Switch on Result' node, baked when its Blueprint is compiled.
+ *
+ * Outputs are indexed in pin order: 'Success', each exact case, each group, each category, then 'Default'. The most
+ * specific case wins: an exact case beats a group containing the same result, and both beat a category case.
+ */
+USTRUCT()
+struct MIRAGANICERRORHANDLING_API FECResultSwitchTable
+{
+	GENERATED_BODY()
+
+	// Hash of the cases, used by the compiled node to find this table.
+	UPROPERTY()
+	int32 Key = 0;
+
+	// The result matched by each exact case pin, in pin order.
+	UPROPERTY()
+	TArray<FECResult> Cases;
+
+	// The results matched by each group pin, in pin order.
+	UPROPERTY()
+	TArray<FECResultSwitchGroup> Groups;
+
+	// The category matched by each category pin, in pin order.
+	UPROPERTY()
+	TArray<TObjectPtr<const UEnum>> Categories;
+
+	// Get the output index for a result. Results which match no case get the 'Default' output, GetNumOutputs() - 1.
+	int32 FindOutputIndex(const FECResult& Selection) const;
+
+	// Get the number of outputs, including 'Success' and 'Default'.
+	int32 GetNumOutputs() const { return Cases.Num() + Groups.Num() + Categories.Num() + 2; }
+
+	// Build the lookup maps. Called after loading or compiling.
+	void BuildLookup();
+
+	// Check if two tables have the same cases, ignoring their keys.
+	bool HasSameCases(const FECResultSwitchTable& Other) const;
+
+	// Compute the key for this table's cases. Stable between sessions, since it uses category paths.
+	int32 ComputeKey() const;
+
+private:
+	// Output index for every result matched by an exact case or a group.
+	TMap<FECResult, int32> CaseLookup;
+	// Output index for every category case.
+	TMap<const UEnum*, int32> CategoryLookup;
+};
+
+/**
+ * Case tables for every 'Switch on Result' node in a Blueprint class. The compiled nodes make one native call which
+ * maps the selection to an output index through these tables, instead of comparing against each case in turn.
+ */
+UCLASS()
+class MIRAGANICERRORHANDLING_API UECResultSwitchBinding : public UDynamicBlueprintBinding
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostLoad() override;
+
+	/**
+	 * Add a table, unless one with the same key already exists.
+	 * @return False if a table with different cases already has the key. Both tables are then unusable, and switches
+	 * using the key take their 'Default' output.
+	 */
+	bool AddTable(const FECResultSwitchTable& Table);
+
+	const FECResultSwitchTable* FindTable(int32 Key) const;
+
+	/**
+	 * Find the switch table for a key in a Blueprint class. Tables are stored on the class which owns the compiled
+	 * function, so parent classes aren't searched.
+	 */
+	static const FECResultSwitchTable* FindTableForClass(const UClass* Class, int32 Key);
+
+protected:
+	UPROPERTY()
+	TArray<FECResultSwitchTable> Tables;
+
+	// Keys shared by tables with different cases.
+	UPROPERTY()
+	TArray<int32> CollidingKeys;
+
+private:
+	void BuildTableIndices();
+
+	// Index in 'Tables' of each usable key.
+	TMap<int32, int32> TableIndices;
+};
@@ -0,0 +1,68 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECCancellation.h"
+#include "ECResult.h"
+#include "ECRetry.generated.h"
+
+/**
+ * When and how often to retry an operation which failed.
+ */
+USTRUCT(BlueprintType)
+struct MIRAGANICERRORHANDLING_API FECRetryPolicy
+{
+	GENERATED_BODY()
+
+	// Total number of attempts, including the first.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "1"))
+	int32 MaxAttempts = 3;
+
+	// Delay before the first retry.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "0", Units = "s"))
+	float InitialDelaySeconds = 0.1f;
+
+	// Each retry waits this many times longer than the previous one.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "1"))
+	float BackoffMultiplier = 2.f;
+
+	// Upper limit for the delay between attempts.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "0", Units = "s"))
+	float MaxDelaySeconds = 5.f;
+
+	// Randomize each delay by up to this fraction, so operations which failed together don't retry together.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error", meta = (ClampMin = "0", ClampMax = "1"))
+	float JitterFraction = 0.2f;
+
+	// Failures which are worth retrying (E.g., 'SpawnCollisionBlocked'). If empty, every failure is retried.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Error")
+	TArray<FECResult> RetryableResults;
+
+	// Check if a failure should be retried. Doesn't check the number of attempts.
+	bool IsRetryable(const FECResult& Result) const;
+
+	// Get the delay before an attempt (2 for the first retry), including jitter.
+	float GetDelayBeforeAttempt(int32 Attempt) const;
+};
+
+namespace Mgnc
+{
+/**
+ * Call 'Attempt' until it succeeds, fails with a result the policy doesn't retry, or runs out of attempts. The first
+ * attempt runs immediately; retries are scheduled on the world's timer manager, so nothing runs between attempts.
+ *
+ * 'OnComplete' is called with the last result and the number of attempts made. If 'Cancellation' is cancelled, no more
+ * attempts are made and 'OnComplete' receives 'Cancelled'. The same happens if the world is torn down first.
+ */
+MIRAGANICERRORHANDLING_API void RetryWithBackoff(
+	UWorld& World,
+	const FECRetryPolicy& Policy,
+	TUniqueFunction<FECResult()> Attempt,
+	TUniqueFunction<void(const FECResult& Result, int32 NumAttempts)> OnComplete,
+	const FECCancellationToken& Cancellation = FECCancellationToken()
+);
+} // namespace Mgnc
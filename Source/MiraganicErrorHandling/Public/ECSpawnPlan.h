@@ -0,0 +1,118 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECValueOrResult.h"
+#include "Engine/World.h"
+
+/**
+ * A prepared 'UWorld::SpawnActor' call for one actor class and set of spawn parameters. The checks which only depend on
+ * the class and parameters run once in Prepare, so each spawn only checks the world state, the transform, the name and
+ * collision. Suits spawners which create the same actor many times (projectiles, pickups, etc.).
+ *
+ * The plan holds the world, class and the objects in its spawn parameters (owner, template, level, etc.) weakly. Once
+ * one of them is destroyed, executing the plan fails with 'SpawnPlanExpired'.
+ *
+ * E.g.,:
+ *
+ * TECValueOrResult<FECSpawnPlan> Plan = FECSpawnPlan::Prepare(World, *ProjectileClass, SpawnParams);
+ * EC_VALIDATE(Plan.GetResult());
+ * ...
+ * AActor* Projectile = nullptr;
+ * EC_VALIDATE(Plan.GetValue().Try_Execute(Projectile, MuzzleTransform));
+ */
+class MIRAGANICERRORHANDLING_API FECSpawnPlan
+{
+public:
+	/**
+	 * Check the class and parameters, and cache what the spawns need. Fails with the same errors as Can_SpawnActor.
+	 */
+	UE_NODISCARD static TECValueOrResult<FECSpawnPlan> Prepare(
+		UWorld& World,
+		UClass& ActorClass,
+		const FActorSpawnParameters& SpawnParams
+	);
+
+	/**
+	 * Check if spawning at 'Transform' would succeed. Only runs the checks which can change between spawns.
+	 */
+	UE_NODISCARD FECResult Can_Execute(const FTransform& Transform) const;
+
+	/**
+	 * Spawn an actor at 'Transform', or return the error which occurred.
+	 */
+	UE_NODISCARD FECResult Try_Execute(AActor*& OutSpawnedActor, const FTransform& Transform) const;
+
+	/**
+	 * Check if this plan can spawn with other parameters, i.e., they only differ in per-spawn settings like the name,
+	 * instigator, or an owner in the same level.
+	 */
+	bool CanShareWith(const FActorSpawnParameters& OtherParams) const;
+
+	/**
+	 * The same as Can_Execute and Try_Execute, but with per-spawn parameters. 'InstanceParams' must pass CanShareWith.
+	 */
+	UE_NODISCARD FECResult Can_Execute(const FTransform& Transform, const FActorSpawnParameters& InstanceParams) const;
+	UE_NODISCARD FECResult Try_Execute(AActor*& OutSpawnedActor,
+		const FTransform& Transform,
+		const FActorSpawnParameters& InstanceParams
+	) const;
+
+	UWorld* GetWorld() const { return World.Get(); }
+	UClass* GetActorClass() const { return ActorClass.Get(); }
+	ULevel* GetLevel() const { return Level.Get(); }
+	// Get the parameters the plan was prepared with. Objects destroyed since then are null.
+	FActorSpawnParameters GetSpawnParams() const;
+
+	// Check whether spawns check for blocking geometry.
+	bool ChecksEncroachment() const { return bCheckEncroachment; }
+
+	// Check if an actor of this plan's class would collide with blocking geometry at 'Transform'.
+	bool IsEncroaching(const FTransform& Transform) const;
+
+private:
+	FECSpawnPlan() = default;
+
+	// Get the plan's own parameters with its weakly held objects filled in, or 'SpawnPlanExpired' if one was destroyed.
+	TECValueOrResult<FActorSpawnParameters> ResolveSpawnParams() const;
+
+	// The per-spawn checks, without checking that the parameters can share this plan.
+	FECResult CheckExecute(const FTransform& Transform, const FActorSpawnParameters& InstanceParams) const;
+
+	// Call 'UWorld::SpawnActor' with parameters that passed CheckExecute.
+	FECResult ExecuteChecked(AActor*& OutSpawnedActor,
+		const FTransform& Transform,
+		const FActorSpawnParameters& ExecParams
+	) const;
+
+	TWeakObjectPtr<UWorld> World;
+	TWeakObjectPtr<UClass> ActorClass;
+	// The class default object, or the template from the spawn parameters.
+	TWeakObjectPtr<AActor> Template;
+	TWeakObjectPtr<ULevel> Level;
+	// Taken out of 'SpawnParams', so an expired plan never passes them to 'UWorld::SpawnActor' dangling.
+	TWeakObjectPtr<AActor> Owner;
+	TWeakObjectPtr<APawn> Instigator;
+#if WITH_EDITOR
+	TWeakObjectPtr<UPackage> OverridePackage;
+#endif
+
+	// The parameters passed to 'UWorld::SpawnActor'. If the plan checks for blocking geometry itself, the collision
+	// handling is overridden to 'AlwaysSpawn', so the check isn't repeated. The spawned actor's
+	// 'SpawnCollisionHandlingMethod' is restored after spawning, but its construction scripts and BeginPlay see
+	// 'AlwaysSpawn'.
+	FActorSpawnParameters SpawnParams;
+	// The collision handling the plan was prepared with, before that override.
+	ESpawnActorCollisionHandlingMethod PreparedCollisionHandling = ESpawnActorCollisionHandlingMethod::Undefined;
+	// Whether the requested name must be checked against names in other packages.
+	bool bNeedGloballyUniqueName = false;
+	// Whether spawns fail when colliding with blocking geometry.
+	bool bCheckEncroachment = false;
+	// The template's root component transform, relative to the actor.
+	FTransform TemplateRootTransform;
+};
@@ -0,0 +1,22 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ErrorHandling"), STATGROUP_ErrorHandling, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Failures Reported"), STAT_ECFailuresReported, STATGROUP_ErrorHandling, MIRAGANICERRORHANDLING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Format Result"), STAT_ECFormatResult, STATGROUP_ErrorHandling, MIRAGANICERRORHANDLING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Log Result"), STAT_ECLogResult, STATGROUP_ErrorHandling, MIRAGANICERRORHANDLING_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MIRAGANICERRORHANDLING_API, ErrorHandling);
+
+// Low-level memory tracker tag for allocations made by the plugin (category metadata, caches, diagnostics).
+LLM_DECLARE_TAG_API(ErrorHandling, MIRAGANICERRORHANDLING_API);
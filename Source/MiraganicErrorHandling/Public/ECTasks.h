@@ -0,0 +1,216 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECValueOrResult.h"
+#include "Tasks/Task.h"
+
+/**
+ * Helpers for UE::Tasks whose bodies return FECResult or TECValueOrResult.
+ *
+ * E.g.,:
+ *
+ * auto Load = Mgnc::LaunchResultTask(TEXT("Load"), [&]() -> TECValueOrResult<FMyData> { ... });
+ * auto Validate = Mgnc::ThenIfSuccess(Load, TEXT("Validate"), [](const FMyData& Data) -> FECResult { ... });
+ *
+ * If 'Load' fails, 'Validate' doesn't run its body and completes with the same failure.
+ */
+namespace Mgnc
+{
+namespace Detail
+{
+template<typename T>
+struct TIsResultType
+{
+	static constexpr bool Value = false;
+};
+
+template<>
+struct TIsResultType<FECResult>
+{
+	static constexpr bool Value = true;
+};
+
+template<typename T>
+struct TIsResultType<TECValueOrResult<T>>
+{
+	static constexpr bool Value = true;
+};
+
+// The result type of a continuation, which is passed the value of its prerequisite (if it has one).
+template<typename InT, typename BodyT>
+struct TContinuationResult
+{
+	using Type = typename TDecay<TInvokeResult_T<BodyT>>::Type;
+};
+
+template<typename ValueT, typename BodyT>
+struct TContinuationResult<TECValueOrResult<ValueT>, BodyT>
+{
+	using Type = typename TDecay<TInvokeResult_T<BodyT, const ValueT&>>::Type;
+};
+
+// Shared between the per-task continuations of WhenAllSucceeded. Only atomics are written after construction.
+template<typename T>
+struct TWhenAllState
+{
+	explicit TWhenAllState(TArray<UE::Tasks::TTask<T>>&& InTasks)
+		: Tasks(MoveTemp(InTasks))
+		, Remaining(Tasks.Num())
+		, Completed(TEXT("Mgnc::WhenAllSucceeded"))
+	{}
+
+	void TriggerOnce()
+	{
+		if (!bTriggered.exchange(true, std::memory_order_acq_rel))
+		{
+			Completed.Trigger();
+		}
+	}
+
+	TArray<UE::Tasks::TTask<T>> Tasks;
+	std::atomic<int32> Remaining;
+	std::atomic<int32> FirstFailure{INDEX_NONE};
+	std::atomic<bool> bTriggered{false};
+	UE::Tasks::FTaskEvent Completed;
+};
+} // namespace Detail
+
+/**
+ * Launch a task whose body returns FECResult or TECValueOrResult.
+ */
+template<typename BodyT>
+auto LaunchResultTask(const TCHAR* DebugName, BodyT&& Body, UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::Normal)
+{
+	static_assert(Detail::TIsResultType<typename TDecay<TInvokeResult_T<BodyT>>::Type>::Value,
+		"Result task bodies must return FECResult or TECValueOrResult.");
+	return UE::Tasks::Launch(DebugName, Forward<BodyT>(Body), Priority);
+}
+
+/**
+ * Launch a task which runs after 'Prev', but only runs its body if 'Prev' succeeded. Otherwise, it completes with
+ * the failure from 'Prev'.
+ *
+ * If 'Prev' returns TECValueOrResult<T>, the body is passed 'const T&'. Otherwise, it takes no arguments. The body must
+ * return FECResult or TECValueOrResult.
+ */
+template<typename InT, typename BodyT>
+auto ThenIfSuccess(
+	const UE::Tasks::TTask<InT>& Prev,
+	const TCHAR* DebugName,
+	BodyT&& Body,
+	UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::Normal)
+{
+	using OutT = typename Detail::TContinuationResult<InT, typename TDecay<BodyT>::Type>::Type;
+	static_assert(Detail::TIsResultType<InT>::Value, "ThenIfSuccess requires a task returning FECResult or TECValueOrResult.");
+	static_assert(Detail::TIsResultType<OutT>::Value, "Result task bodies must return FECResult or TECValueOrResult.");
+
+	return UE::Tasks::Launch(
+		DebugName,
+		[Prev, Body = Forward<BodyT>(Body)]() mutable -> OutT
+		{
+			const InT& In = Prev.GetResult();
+			if (In.IsFailure())
+			{
+				return OutT(GetResultOf(In));
+			}
+
+			if constexpr (TIsSame<InT, FECResult>::Value)
+			{
+				return Invoke(Body);
+			}
+			else
+			{
+				return Invoke(Body, In.GetValue());
+			}
+		},
+		UE::Tasks::Prerequisites(Prev),
+		Priority);
+}
+
+/**
+ * Get a task which completes with 'Success' once every task succeeded, or with the first failure as soon as any task
+ * fails, without waiting for the rest. "First" means first to complete, so it can vary between runs.
+ */
+template<typename T, typename AllocatorT>
+UE::Tasks::TTask<FECResult> WhenAllSucceeded(const TArray<UE::Tasks::TTask<T>, AllocatorT>& Tasks)
+{
+	static_assert(Detail::TIsResultType<T>::Value, "WhenAllSucceeded requires tasks returning FECResult or TECValueOrResult.");
+
+	using FState = Detail::TWhenAllState<T>;
+	const TSharedRef<FState, ESPMode::ThreadSafe> State =
+		MakeShared<FState, ESPMode::ThreadSafe>(TArray<UE::Tasks::TTask<T>>(Tasks));
+
+	if (State->Tasks.IsEmpty())
+	{
+		State->TriggerOnce();
+	}
+
+	for (int32 Idx = 0; Idx < State->Tasks.Num(); ++Idx)
+	{
+		UE::Tasks::Launch(
+			TEXT("Mgnc::WhenAllSucceeded.Check"),
+			[State, Idx]()
+			{
+				if (GetResultOf(State->Tasks[Idx].GetResult()).IsFailure())
+				{
+					int32 Expected = INDEX_NONE;
+					if (State->FirstFailure.compare_exchange_strong(Expected, Idx, std::memory_order_acq_rel))
+					{
+						State->TriggerOnce();
+					}
+				}
+				if (State->Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					State->TriggerOnce();
+				}
+			},
+			UE::Tasks::Prerequisites(State->Tasks[Idx]),
+			UE::Tasks::ETaskPriority::Normal,
+			UE::Tasks::EExtendedTaskPriority::Inline);
+	}
+
+	return UE::Tasks::Launch(
+		TEXT("Mgnc::WhenAllSucceeded"),
+		[State]() -> FECResult
+		{
+			const int32 FailedIdx = State->FirstFailure.load(std::memory_order_acquire);
+			return FailedIdx == INDEX_NONE ? FECResult::Success() : GetResultOf(State->Tasks[FailedIdx].GetResult());
+		},
+		UE::Tasks::Prerequisites(State->Completed),
+		UE::Tasks::ETaskPriority::Normal,
+		UE::Tasks::EExtendedTaskPriority::Inline);
+}
+
+/**
+ * Get a task which waits for every task and completes with each distinct failure, in task order. Empty if all tasks
+ * succeeded.
+ */
+template<typename T, typename AllocatorT>
+UE::Tasks::TTask<TArray<FECResult>> WhenAllDistinctFailures(const TArray<UE::Tasks::TTask<T>, AllocatorT>& Tasks)
+{
+	static_assert(Detail::TIsResultType<T>::Value, "WhenAllDistinctFailures requires tasks returning FECResult or TECValueOrResult.");
+
+	return UE::Tasks::Launch(
+		TEXT("Mgnc::WhenAllDistinctFailures"),
+		[Tasks = TArray<UE::Tasks::TTask<T>>(Tasks)]() mutable
+		{
+			TArray<FECResult> Failures;
+			for (UE::Tasks::TTask<T>& Task : Tasks)
+			{
+				const FECResult& Result = GetResultOf(Task.GetResult());
+				if (Result.IsFailure())
+				{
+					Failures.AddUnique(Result);
+				}
+			}
+			return Failures;
+		},
+		Tasks);
+}
+} // namespace Mgnc
@@ -0,0 +1,109 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECValueOrResult.generated.h"
+
+/**
+ * Errors from misusing TECValueOrResult.
+ */
+UENUM(meta = (ErrorCategory))
+enum class EECValueOrResultError : int64
+{
+	Success = 0,
+	// A value-or-result was constructed from 'Success', so it had neither a value nor a failure.
+	ConstructedFromSuccess,
+};
+
+namespace Mgnc::Detail
+{
+MIRAGANICERRORHANDLING_API void LogValueOrResultConstructedFromSuccess();
+} // namespace Mgnc::Detail
+
+/**
+ * Either a value or a failing result.
+ *
+ * E.g.,:
+ *
+ * TECValueOrResult<FInventorySlot> FindFreeSlot(...)
+ * {
+ *     if (Slots.IsEmpty())
+ *     {
+ *         return EInventoryResult::NoSlots;
+ *     }
+ *     return Slots[0];
+ * }
+ *
+ * Converts implicitly to FECResult ('Success' if it holds a value), so it can be used with EC_VALIDATE.
+ */
+template<typename T>
+class TECValueOrResult
+{
+public:
+	using ValueType = T;
+
+	TECValueOrResult(const T& InValue)
+		: Value(InValue)
+	{}
+
+	TECValueOrResult(T&& InValue)
+		: Value(MoveTemp(InValue))
+	{}
+
+	// Construct from a failure. Constructing from 'Success' logs an error and stores 'ConstructedFromSuccess', so
+	// callers never see a success without a value.
+	TECValueOrResult(const FECResult& InResult)
+		: Result(InResult)
+	{
+		if (UNLIKELY(Result.IsSuccess()))
+		{
+			Result = EECValueOrResultError::ConstructedFromSuccess;
+			Mgnc::Detail::LogValueOrResultConstructedFromSuccess();
+		}
+	}
+
+	template<typename EnumT, typename = typename TEnableIf<TIsEnumClass<EnumT>::Value || TIsEnum<EnumT>::Value>::Type>
+	TECValueOrResult(EnumT InEnum)
+		: TECValueOrResult(FECResult(InEnum))
+	{}
+
+	bool HasValue() const { return Value.IsSet(); }
+	bool IsSuccess() const { return Value.IsSet(); }
+	bool IsFailure() const { return !Value.IsSet(); }
+
+	// Get the value. Only valid if this succeeded.
+	T& GetValue() { return Value.GetValue(); }
+	const T& GetValue() const { return Value.GetValue(); }
+
+	// Move the value out. Only valid if this succeeded.
+	T StealValue() { return MoveTemp(Value.GetValue()); }
+
+	// Get the failure, or 'Success' if this holds a value.
+	const FECResult& GetResult() const { return Result; }
+
+	operator const FECResult&() const { return Result; }
+
+private:
+	TOptional<T> Value;
+	FECResult Result;
+};
+
+namespace Mgnc
+{
+// Get the result of an FECResult or value-or-result. Used by generic helpers which accept either.
+FORCEINLINE const FECResult& GetResultOf(const FECResult& Result)
+{
+	return Result;
+}
+
+template<typename T>
+FORCEINLINE const FECResult& GetResultOf(const TECValueOrResult<T>& ValueOrResult)
+{
+	return ValueOrResult.GetResult();
+}
+} // namespace Mgnc
@@ -50,6 +50,7 @@ public class MiraganicErrorHandlingEditor : ModuleRules
 					"EditorStyle",
 					"EditorWidgets",
 					"KismetCompiler",
+					"ToolMenus",
 				}
 			);
 		}
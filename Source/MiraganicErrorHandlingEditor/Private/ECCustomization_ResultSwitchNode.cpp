@@ -36,6 +36,8 @@ void FECCustomization_ResultSwitchNode::CustomizeDetails(IDetailLayoutBuilder& D
 	
 	IDetailCategoryBuilder& PinOptionsBuilder = DetailBuilder.EditCategory(TEXT("PinOptions"));
 	PinOptionsBuilder.AddProperty(PinErrorCodesProperty);
+	PinOptionsBuilder.AddProperty(DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UECK2Node_SwitchResult, PinGroupCases)));
+	PinOptionsBuilder.AddProperty(DetailBuilder.GetProperty(GET_MEMBER_NAME_CHECKED(UECK2Node_SwitchResult, PinCategoryCases)));
 	PinOptionsBuilder.AddCustomRow(FText::GetEmpty())
 		.WholeRowContent()
 		[
@@ -52,29 +54,49 @@ void FECCustomization_ResultSwitchNode::CustomizeDetails(IDetailLayoutBuilder& D
 				.ComboButtonStyle(FAppStyle::Get(), "BlueprintEditor.CompactVariableTypeSelector")
 				.ButtonContent()
 				[
-					SNew(SHorizontalBox)
-					+SHorizontalBox::Slot()
-					.Padding(2.f, 0.f)
-					.HAlign(HAlign_Center)
-					.VAlign(VAlign_Center)
-					.AutoWidth()
-					[
-						SNew(SImage)
-						.Image(FAppStyle::GetBrush(TEXT("Icons.PlusCircle")))
-						.ColorAndOpacity(FSlateColor::UseForeground())
-					]
-					+SHorizontalBox::Slot()
-					.AutoWidth()
-					.Padding(2.f, 0.f)
-					.HAlign(HAlign_Left)
-					.VAlign(VAlign_Center)
-					[
-						SNew(STextBlock)
-						.Text(LOCTEXT("ButtonLabel_AddCategory", "Add Category"))
-						.Font(IDetailLayoutBuilder::GetDetailFont())
-					]
+					MakeAddButtonContent(LOCTEXT("ButtonLabel_AddCategory", "Add Category"))
 				]
 			]
+			+SHorizontalBox::Slot()
+			.Padding(4.f, 2.f, 0.f, 2.f)
+			.AutoWidth()
+			[
+				SAssignNew(AddCategoryCaseComboButton, SComboButton)
+				.OnGetMenuContent(this, &FECCustomization_ResultSwitchNode::GenerateAddCategoryCaseMenu)
+				.ContentPadding(2.f)
+				.ToolTipText(LOCTEXT("Tooltip_AddCategoryCase", "Add one pin which matches any error from a category"))
+				.IsEnabled(PinErrorCodesProperty->IsEditable())
+				.ComboButtonStyle(FAppStyle::Get(), "BlueprintEditor.CompactVariableTypeSelector")
+				.ButtonContent()
+				[
+					MakeAddButtonContent(LOCTEXT("ButtonLabel_AddCategoryCase", "Match Category"))
+				]
+			]
+		];
+}
+
+TSharedRef<SWidget> FECCustomization_ResultSwitchNode::MakeAddButtonContent(const FText& Label)
+{
+	return SNew(SHorizontalBox)
+		+SHorizontalBox::Slot()
+		.Padding(2.f, 0.f)
+		.HAlign(HAlign_Center)
+		.VAlign(VAlign_Center)
+		.AutoWidth()
+		[
+			SNew(SImage)
+			.Image(FAppStyle::GetBrush(TEXT("Icons.PlusCircle")))
+			.ColorAndOpacity(FSlateColor::UseForeground())
+		]
+		+SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(2.f, 0.f)
+		.HAlign(HAlign_Left)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(Label)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
 		];
 }
 
@@ -95,6 +117,23 @@ TSharedRef<SWidget> FECCustomization_ResultSwitchNode::GenerateAddCategoryMenu()
 		];
 }
 
+TSharedRef<SWidget> FECCustomization_ResultSwitchNode::GenerateAddCategoryCaseMenu()
+{
+	return SNew(SBox)
+		.WidthOverride(280.f)
+		[
+			SNew(SVerticalBox)
+			+SVerticalBox::Slot()
+			.AutoHeight()
+			.MaxHeight(500.f)
+			[
+				SNew(SECWidget_ErrorCategoryList)
+				.PostErrorCategoryPicked(this, &FECCustomization_ResultSwitchNode::AddCategoryCase)
+				.bAutoFocus(true)
+			]
+		];
+}
+
 void FECCustomization_ResultSwitchNode::AddUniqueCodesFromCategory(const UEnum* ErrorCategory)
 {
 	check(IsValid(ErrorCategory));
@@ -113,4 +152,20 @@ void FECCustomization_ResultSwitchNode::AddUniqueCodesFromCategory(const UEnum*
 	AddCategoryComboButton->SetIsOpen(false);
 }
 
+void FECCustomization_ResultSwitchNode::AddCategoryCase(const UEnum* ErrorCategory)
+{
+	check(IsValid(ErrorCategory));
+
+	const FScopedTransaction Transaction(NSLOCTEXT("ErrorCodesEditor_SwitchErrorCodeGraphNode", "AddCategoryCase", "Add Category Case"));
+	TargetNode->Modify();
+
+	if (TargetNode->AddCategoryCase(*ErrorCategory))
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(TargetNode->GetBlueprint());
+		TargetNode->GetGraph()->NotifyGraphChanged();
+	}
+
+	AddCategoryCaseComboButton->SetIsOpen(false);
+}
+
 #undef LOCTEXT_NAMESPACE
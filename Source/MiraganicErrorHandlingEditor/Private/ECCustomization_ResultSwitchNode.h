@@ -19,11 +19,15 @@ public:
 
 private:
 	TSharedRef<SWidget> GenerateAddCategoryMenu();
+	TSharedRef<SWidget> GenerateAddCategoryCaseMenu();
+	static TSharedRef<SWidget> MakeAddButtonContent(const FText& Label);
 
 	void AddUniqueCodesFromCategory(const UEnum* ErrorCategory);
+	void AddCategoryCase(const UEnum* ErrorCategory);
 	
 	TWeakObjectPtr<UECK2Node_SwitchResult> TargetNode;
 
 	TSharedPtr<SComboButton> AddCategoryComboButton;
+	TSharedPtr<SComboButton> AddCategoryCaseComboButton;
 	
 };
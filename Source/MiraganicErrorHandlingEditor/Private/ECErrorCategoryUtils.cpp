@@ -6,6 +6,7 @@
 
 #include "ECErrorCategoryUtils.h"
 #include "ECErrorCategory.h"
+#include "ECMessageFormat.h"
 #include "ECResult.h"
 #include "IECNodeDependingOnErrorCategory.h"
 #include "K2Node_Variable.h"
@@ -49,6 +50,8 @@ void ErrorHandling::BroadcastPostChange(const UECErrorCategory& ErrorCategory,
 	bool bResolveData
 )
 {
+	FECMessageFormatCache::Get().Invalidate(ErrorCategory);
+
 	if (bResolveData)
 	{
 		FArchiveEnumeratorResolver EnumeratorResolver(&ErrorCategory, OldNames);
@@ -313,6 +316,7 @@ void ErrorHandling::SetErrorValueMessage(UECErrorCategory& Category, int32 Idx,
 	// const FScopedTransaction Transaction(NSLOCTEXT("EnumEditor", "SetEnumeratorTooltip", "Set Description"));
 	Category.Modify();
 	Category.SetMetaData(TEXT("ToolTip"), *NewMessage.ToString(), Idx);
+	FECMessageFormatCache::Get().Invalidate(Category);
 }
 
 void ErrorHandling::AddErrorValueToCategory(UECErrorCategory& Category, int64 NewCode)
@@ -0,0 +1,90 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECK2Node_CallSwitchResultLookup.h"
+
+#include "ECK2Node_SelectResult.h"
+#include "ECK2Node_SwitchResult.h"
+#include "ECResultSwitchBinding.h"
+#include "K2Node_MacroInstance.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+
+#define LOCTEXT_NAMESPACE "ErrorHandlingEditor_K2NodeCallSwitchResultLookup"
+
+UClass* UECK2Node_CallSwitchResultLookup::GetDynamicBindingClass() const
+{
+	return UECResultSwitchBinding::StaticClass();
+}
+
+void UECK2Node_CallSwitchResultLookup::RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const
+{
+	CastChecked<UECResultSwitchBinding>(BindingObject)->AddTable(Table);
+}
+
+void UECK2Node_CallSwitchResultLookup::ValidateTableKey(const UK2Node& Node,
+	const FECResultSwitchTable& Table,
+	FCompilerResultsLog& MessageLog
+	)
+{
+	const UBlueprint* Blueprint = Node.GetBlueprint();
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	const auto CheckOtherNode = [&Node, &Table, &MessageLog](const UK2Node* OtherNode, const FECResultSwitchTable& OtherTable)
+	{
+		// Nodes without cases don't compile to a lookup.
+		if (OtherNode == &Node || OtherTable.Key != Table.Key || OtherTable.GetNumOutputs() == 2 || OtherTable.HasSameCases(Table))
+		{
+			return false;
+		}
+
+		MessageLog.Error(*LOCTEXT("TableKeyCollision", "@@ and @@ have different cases which compile to the same key. Change the cases of one of them.").ToString(),
+			&Node, OtherNode);
+		return true;
+	};
+
+	// Switches in macros, including macro libraries, register their tables with this Blueprint's class too.
+	TArray<UEdGraph*> GraphsToVisit;
+	FBlueprintEditorUtils::GetAllGraphs(Blueprint, GraphsToVisit);
+	TSet<const UEdGraph*> VisitedGraphs;
+	while (!GraphsToVisit.IsEmpty())
+	{
+		UEdGraph* Graph = GraphsToVisit.Pop(false);
+		if (!Graph || VisitedGraphs.Contains(Graph))
+		{
+			continue;
+		}
+		VisitedGraphs.Add(Graph);
+		GraphsToVisit.Append(Graph->SubGraphs);
+
+		for (const UEdGraphNode* GraphNode : Graph->Nodes)
+		{
+			if (const UECK2Node_SwitchResult* SwitchNode = Cast<UECK2Node_SwitchResult>(GraphNode))
+			{
+				if (CheckOtherNode(SwitchNode, SwitchNode->BuildSwitchTable()))
+				{
+					return;
+				}
+			}
+			else if (const UECK2Node_SelectResult* SelectNode = Cast<UECK2Node_SelectResult>(GraphNode))
+			{
+				if (CheckOtherNode(SelectNode, SelectNode->BuildSwitchTable()))
+				{
+					return;
+				}
+			}
+			else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(GraphNode))
+			{
+				GraphsToVisit.Add(MacroNode->GetMacroGraph());
+			}
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
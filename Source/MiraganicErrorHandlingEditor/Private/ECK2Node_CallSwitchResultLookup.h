@@ -0,0 +1,38 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResultSwitchBinding.h"
+#include "K2Node_CallFunction.h"
+#include "ECK2Node_CallSwitchResultLookup.generated.h"
+
+/**
+ * Intermediate node spawned when compiling 'Switch on Result' and 'Select on Result'. Calls the output index lookup,
+ * and bakes the node's cases into the generated class so the lookup can find them at runtime.
+ */
+UCLASS()
+class UECK2Node_CallSwitchResultLookup : public UK2Node_CallFunction
+{
+	GENERATED_BODY()
+
+public:
+	// UK2Node interface
+	virtual UClass* GetDynamicBindingClass() const override;
+	virtual void RegisterDynamicBinding(UDynamicBlueprintBinding* BindingObject) const override;
+	// End of UK2Node interface
+
+	/**
+	 * Report a compile error if another result switch or select node in the same Blueprint, or in a macro it uses,
+	 * compiles to a table with the same key but different cases. Called when expanding, so switches expanded from
+	 * macros are checked too.
+	 */
+	static void ValidateTableKey(const UK2Node& Node, const FECResultSwitchTable& Table, class FCompilerResultsLog& MessageLog);
+
+	// The switch's cases, baked into the generated class on compile.
+	UPROPERTY()
+	FECResultSwitchTable Table;
+};
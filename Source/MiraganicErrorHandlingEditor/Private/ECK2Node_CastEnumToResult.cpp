@@ -14,6 +14,7 @@
 #include "EdGraphUtilities.h"
 #include "EditorCategoryUtils.h"
 #include "K2Node_CallFunction.h"
+#include "K2Node_Knot.h"
 #include "KismetCompiler.h"
 #include "Kismet/KismetNodeHelperLibrary.h"
 #include "Kismet2/CompilerResultsLog.h"
@@ -90,6 +91,14 @@ void UECK2Node_CastEnumToResult::ExpandNode(FKismetCompilerContext& CompilerCont
 		return;
 	}
 
+	UEdGraphPin* OrgInputPin = FindPinChecked(GetEnumInputPinName());
+	if (OrgInputPin->LinkedTo.Num() == 0)
+	{
+		// The value is known now, so there's nothing to validate or convert at runtime.
+		ExpandLiteral(CompilerContext, SourceGraph);
+		return;
+	}
+
 	const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
 
 	// FUNCTION NODE
@@ -106,24 +115,9 @@ void UECK2Node_CastEnumToResult::ExpandNode(FKismetCompilerContext& CompilerCont
 	Schema->TrySetDefaultObject(*FunctionEnumPin, Enum);
 	check(FunctionEnumPin->DefaultObject == Enum);
 
-	// Enum value pin
-	UEdGraphPin* OrgInputPin = FindPinChecked(GetEnumInputPinName());
+	// Enum value pin. Linked Blueprint enums are always bytes, so they connect directly.
 	UEdGraphPin* FunctionValuePin = FunctionCall->FindPinChecked(TEXT("EnumValue"));
-	
-	if (OrgInputPin->LinkedTo.Num() == 0)
-	{
-		// Pass default value as byte
-		int32 Index = Enum->GetIndexByName(*OrgInputPin->DefaultValue);
-		if (Index != INDEX_NONE)
-		{
-			FunctionValuePin->DefaultValue = FString::FromInt(Enum->GetValueByIndex(Index));
-		}
-	}
-	else
-	{
-		// Connect directly
-		CompilerContext.MovePinLinksToIntermediate(*OrgInputPin, *FunctionValuePin);
-	}
+	CompilerContext.MovePinLinksToIntermediate(*OrgInputPin, *FunctionValuePin);
 	
 	// Output pin
 	UEdGraphPin* FunctionReturnPin = FunctionCall->FindPinChecked(UEdGraphSchema_K2::PN_ReturnValue);
@@ -131,6 +125,57 @@ void UECK2Node_CastEnumToResult::ExpandNode(FKismetCompilerContext& CompilerCont
 	CompilerContext.MovePinLinksToIntermediate(*OrgReturnPin, *FunctionReturnPin);
 }
 
+void UECK2Node_CastEnumToResult::ExpandLiteral(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	const UEdGraphPin* OrgInputPin = FindPinChecked(GetEnumInputPinName());
+	const int32 Index = Enum->GetIndexByName(*OrgInputPin->DefaultValue);
+	if (Index == INDEX_NONE)
+	{
+		// Reported by ValidateNodeDuringCompilation.
+		return;
+	}
+
+	const int64 Value = Enum->GetValueByIndex(Index);
+	const FECResult Literal = Value == FECResult::GetSuccessValue()
+		? FECResult::Success() : FECResult::ConstructRaw(Enum, Value);
+	FString LiteralText;
+	FECResult::StaticStruct()->ExportText(LiteralText, &Literal, nullptr, nullptr, PPF_None, nullptr);
+
+	// Pins which take a result by value or const reference become literals. Anything else (reroutes, references,
+	// wildcards) reads a 'Make Result' node with the literal instead.
+	UK2Node_CallFunction* MakeResult = nullptr;
+	UEdGraphPin* OrgReturnPin = FindPinChecked(UEdGraphSchema_K2::PN_ReturnValue);
+	const TArray<UEdGraphPin*> LinkedPins = OrgReturnPin->LinkedTo;
+	for (UEdGraphPin* LinkedPin : LinkedPins)
+	{
+		const FEdGraphPinType& PinType = LinkedPin->PinType;
+		const bool bCanTakeLiteral = PinType.PinCategory == UEdGraphSchema_K2::PC_Struct
+			&& PinType.PinSubCategoryObject == FECResult::StaticStruct()
+			&& !PinType.IsContainer()
+			&& (!PinType.bIsReference || PinType.bIsConst)
+			&& !Cast<UK2Node_Knot>(LinkedPin->GetOwningNode());
+		OrgReturnPin->BreakLinkTo(LinkedPin);
+		if (bCanTakeLiteral)
+		{
+			LinkedPin->DefaultValue = LiteralText;
+			continue;
+		}
+
+		if (!MakeResult)
+		{
+			const UFunction* MakeFunction = UECErrorFunctionLibrary::StaticClass()->FindFunctionByName(
+				GET_FUNCTION_NAME_CHECKED(UECErrorFunctionLibrary, MakeResult));
+			MakeResult = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+			MakeResult->SetFromFunction(MakeFunction);
+			MakeResult->AllocateDefaultPins();
+			MakeResult->FindPinChecked(TEXT("Result"))->DefaultValue = LiteralText;
+		}
+		MakeResult->GetReturnValuePin()->MakeLinkTo(LinkedPin);
+	}
+
+	BreakAllNodeLinks();
+}
+
 bool UECK2Node_CastEnumToResult::IsConnectionDisallowed(const UEdGraphPin* MyPin,
 	const UEdGraphPin* OtherPin,
 	FString& OutReason
@@ -0,0 +1,155 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECK2Node_PropagateFailure.h"
+
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "ECErrorFunctionLibrary.h"
+#include "ECResult.h"
+#include "K2Node_AssignmentStatement.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_FunctionResult.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_TemporaryVariable.h"
+#include "KismetCompiler.h"
+
+#define LOCTEXT_NAMESPACE "ErrorHandlingEditor_K2NodePropagateFailure"
+
+namespace Mgnc::Detail
+{
+// Find the pin on a return node which receives the function's result.
+static UEdGraphPin* FindReturnResultPin(UK2Node_FunctionResult& ReturnNode)
+{
+	UEdGraphPin* FoundPin = nullptr;
+	for (UEdGraphPin* Pin : ReturnNode.Pins)
+	{
+		if (Pin->Direction != EGPD_Input || Pin->PinType.PinSubCategoryObject != FECResult::StaticStruct()
+			|| Pin->PinType.IsContainer())
+		{
+			continue;
+		}
+		// Prefer the return value if the function has several result outputs.
+		if (!FoundPin || Pin->PinName == UEdGraphSchema_K2::PN_ReturnValue)
+		{
+			FoundPin = Pin;
+		}
+	}
+	return FoundPin;
+}
+} // namespace Mgnc::Detail
+
+void UECK2Node_PropagateFailure::AllocateDefaultPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+	UEdGraphPin* ResultPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, FECResult::StaticStruct(), GetResultPinName());
+	GetDefault<UEdGraphSchema_K2>()->SetPinAutogeneratedDefaultValueBasedOnType(ResultPin);
+	Super::AllocateDefaultPins();
+}
+
+FText UECK2Node_PropagateFailure::GetTooltipText() const
+{
+	return LOCTEXT("K2Node_PropagateFailure_ToolTip",
+		"Continues if 'Result' is a success. Else, returns 'Result' from the function immediately.");
+}
+
+FText UECK2Node_PropagateFailure::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("K2Node_PropagateFailure_Title", "Propagate Failure");
+}
+
+FSlateIcon UECK2Node_PropagateFailure::GetIconAndTint(FLinearColor& OutColor) const
+{
+	static FSlateIcon Icon("EditorStyle", "GraphEditor.Branch_16x");
+	return Icon;
+}
+
+bool UECK2Node_PropagateFailure::IsCompatibleWithGraph(const UEdGraph* TargetGraph) const
+{
+	const UEdGraphSchema_K2* Schema = Cast<UEdGraphSchema_K2>(TargetGraph->GetSchema());
+	return Schema && Schema->GetGraphType(TargetGraph) == GT_Function && Super::IsCompatibleWithGraph(TargetGraph);
+}
+
+void UECK2Node_PropagateFailure::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	// Use an existing return node as the template, so the new one has the function's signature.
+	TArray<UK2Node_FunctionResult*> ExistingReturnNodes;
+	SourceGraph->GetNodesOfClass(ExistingReturnNodes);
+	UEdGraphPin* ExistingReturnPin = ExistingReturnNodes.IsEmpty()
+		? nullptr : Mgnc::Detail::FindReturnResultPin(*ExistingReturnNodes[0]);
+	if (!ExistingReturnPin)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("PropagateFailure_NoResultOutput",
+			"@@ can only be used in functions which return a Result.").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	UK2Node_FunctionResult* ReturnNode = CompilerContext.SpawnIntermediateNode<UK2Node_FunctionResult>(this, SourceGraph);
+	ReturnNode->FunctionReference = ExistingReturnNodes[0]->FunctionReference;
+	ReturnNode->UserDefinedPins = ExistingReturnNodes[0]->UserDefinedPins;
+	ReturnNode->AllocateDefaultPins();
+	UEdGraphPin* ReturnResultPin = ReturnNode->FindPinChecked(ExistingReturnPin->PinName, EGPD_Input);
+
+	const UFunction* IsFailureFunction = UECErrorFunctionLibrary::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UECErrorFunctionLibrary, IsFailure));
+	UK2Node_CallFunction* IsFailure = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	IsFailure->SetFromFunction(IsFailureFunction);
+	IsFailure->AllocateDefaultPins();
+
+	UK2Node_IfThenElse* Branch = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+	Branch->AllocateDefaultPins();
+
+	// Pure nodes are evaluated once per consumer, so store the result before testing and returning it.
+	UK2Node_TemporaryVariable* ResultVariable = CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(this, SourceGraph);
+	ResultVariable->VariableType = ExistingReturnPin->PinType;
+	ResultVariable->AllocateDefaultPins();
+	UEdGraphPin* ResultVariablePin = ResultVariable->GetVariablePin();
+
+	UK2Node_AssignmentStatement* AssignResult = CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+	AssignResult->AllocateDefaultPins();
+	ResultVariablePin->MakeLinkTo(AssignResult->GetVariablePin());
+	AssignResult->NotifyPinConnectionListChanged(AssignResult->GetVariablePin());
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GetResultPinName(), EGPD_Input), *AssignResult->GetValuePin());
+
+	ResultVariablePin->MakeLinkTo(IsFailure->FindPinChecked(TEXT("Result"), EGPD_Input));
+	ResultVariablePin->MakeLinkTo(ReturnResultPin);
+
+	IsFailure->GetReturnValuePin()->MakeLinkTo(Branch->GetConditionPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *AssignResult->GetExecPin());
+	AssignResult->GetThenPin()->MakeLinkTo(Branch->GetExecPin());
+	Branch->GetThenPin()->MakeLinkTo(ReturnNode->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), *Branch->GetElsePin());
+
+	BreakAllNodeLinks();
+}
+
+void UECK2Node_PropagateFailure::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+FText UECK2Node_PropagateFailure::GetMenuCategory() const
+{
+	return LOCTEXT("MenuCategory", "ErrorHandling");
+}
+
+FName UECK2Node_PropagateFailure::GetResultPinName()
+{
+	return TEXT("Result");
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,374 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+
+#include "ECK2Node_SelectResult.h"
+
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "ECErrorFunctionLibrary.h"
+#include "ECK2Node_CallSwitchResultLookup.h"
+#include "ECResultSwitchBinding.h"
+#include "K2Node_Select.h"
+#include "KismetCompiler.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "ScopedTransaction.h"
+#include "ToolMenus.h"
+
+#define LOCTEXT_NAMESPACE "ErrorHandlingEditor_K2NodeSelectResult"
+
+UECK2Node_SelectResult::UECK2Node_SelectResult(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	ValuePinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+}
+
+void UECK2Node_SelectResult::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	const FName PropertyName = (PropertyChangedEvent.MemberProperty ? PropertyChangedEvent.MemberProperty->GetFName() : NAME_None);
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UECK2Node_SelectResult, PinResultCodes))
+	{
+		ReconstructNode();
+		GetGraph()->NotifyGraphChanged();
+	}
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+void UECK2Node_SelectResult::AllocateDefaultPins()
+{
+	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+
+	UEdGraphPin* SelectionPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, FECResult::StaticStruct(), GetSelectionPinName());
+	K2Schema->SetPinAutogeneratedDefaultValueBasedOnType(SelectionPin);
+
+	UEdGraphPin* SuccessPin = CreatePin(EGPD_Input, ValuePinType, GetSuccessOptionPinName());
+	SuccessPin->PinFriendlyName = LOCTEXT("FriendlyName_SuccessPin", "Success");
+
+	const TArray<FName> CasePinNames = GetCaseOptionPinNames();
+	for (int32 CaseIndex = 0; CaseIndex < PinResultCodes.Num(); ++CaseIndex)
+	{
+		const FECResult& ResultCode = PinResultCodes[CaseIndex];
+		UEdGraphPin* CasePin = CreatePin(EGPD_Input, ValuePinType, CasePinNames[CaseIndex]);
+		CasePin->PinFriendlyName = ResultCode.HasValidError() ? ResultCode.GetTitle() : LOCTEXT("FriendlyName_InvalidPin", "[INVALID]");
+		CasePin->PinToolTip = ResultCode.ToString();
+	}
+
+	UEdGraphPin* DefaultPin = CreatePin(EGPD_Input, ValuePinType, GetDefaultOptionPinName());
+	DefaultPin->PinFriendlyName = LOCTEXT("FriendlyName_DefaultPin", "Default");
+	DefaultPin->PinToolTip = TEXT("Any result which matches no case.");
+
+	CreatePin(EGPD_Output, ValuePinType, UEdGraphSchema_K2::PN_ReturnValue);
+
+	TArray<UEdGraphPin*> ValuePins;
+	GetValuePins(ValuePins);
+	for (UEdGraphPin* ValuePin : ValuePins)
+	{
+		if (ValuePin->Direction == EGPD_Input)
+		{
+			K2Schema->SetPinAutogeneratedDefaultValueBasedOnType(ValuePin);
+		}
+	}
+
+	Super::AllocateDefaultPins();
+}
+
+FText UECK2Node_SelectResult::GetTooltipText() const
+{
+	return LOCTEXT("K2Node_SelectResult_ToolTip", "Returns the option that matches the selected result");
+}
+
+FText UECK2Node_SelectResult::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("K2Node_SelectResult_Title", "Select on Result");
+}
+
+void UECK2Node_SelectResult::ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	if (ValuePinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+	{
+		MessageLog.Error(*LOCTEXT("SelectResult_Wildcard", "@@ must have an option or return value connected.").ToString(), this);
+	}
+
+	for (const FECResult& PinResultCode : PinResultCodes)
+	{
+		if (!PinResultCode.HasValidError())
+		{
+			MessageLog.Error(*LOCTEXT("SelectResult_InvalidCase", "@@ contains invalid case(s).").ToString(), this);
+			return;
+		}
+	}
+}
+
+void UECK2Node_SelectResult::GetNodeContextMenuActions(UToolMenu* Menu, UGraphNodeContextMenuContext* Context) const
+{
+	Super::GetNodeContextMenuActions(Menu, Context);
+
+	if (Context->bIsDebugging || !Context->Pin)
+	{
+		return;
+	}
+
+	const int32 CaseIndex = GetCaseOptionPinNames().IndexOfByKey(Context->Pin->PinName);
+	if (CaseIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FToolMenuSection& Section = Menu->AddSection("SelectResultPinActions", LOCTEXT("PinActionsMenuHeader", "Pin Actions"));
+	Section.AddMenuEntry(
+		"RemoveCase",
+		LOCTEXT("RemoveCase", "Remove case"),
+		LOCTEXT("RemoveCaseTooltip", "Remove this case and its option pin"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateUObject(const_cast<UECK2Node_SelectResult*>(this), &UECK2Node_SelectResult::RemoveCase, CaseIndex)));
+}
+
+void UECK2Node_SelectResult::PreloadRequiredAssets()
+{
+	for (const FECResult& ResultCode : PinResultCodes)
+	{
+		PreloadObject(const_cast<UEnum*>(ResultCode.GetCategory()));
+	}
+	Super::PreloadRequiredAssets();
+}
+
+bool UECK2Node_SelectResult::IsConnectionDisallowed(const UEdGraphPin* MyPin,
+	const UEdGraphPin* OtherPin,
+	FString& OutReason
+	) const
+{
+	if (MyPin->PinName != GetSelectionPinName() && OtherPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+	{
+		OutReason = LOCTEXT("ExecConnectionDisallowed", "Cannot select an execution pin.").ToString();
+		return true;
+	}
+	return Super::IsConnectionDisallowed(MyPin, OtherPin, OutReason);
+}
+
+void UECK2Node_SelectResult::NotifyPinConnectionListChanged(UEdGraphPin* Pin)
+{
+	Super::NotifyPinConnectionListChanged(Pin);
+
+	if (Pin->PinName == GetSelectionPinName())
+	{
+		return;
+	}
+
+	TArray<UEdGraphPin*> ValuePins;
+	GetValuePins(ValuePins);
+
+	FEdGraphPinType NewType = ValuePinType;
+	if (ValuePinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard && Pin->LinkedTo.Num() > 0)
+	{
+		// Adopt the type of the first connection.
+		NewType = Pin->LinkedTo[0]->PinType;
+		NewType.bIsReference = false;
+		NewType.bIsConst = false;
+	}
+	else if (ValuePinType.PinCategory != UEdGraphSchema_K2::PC_Wildcard
+		&& !ValuePins.ContainsByPredicate([](const UEdGraphPin* ValuePin) { return ValuePin->LinkedTo.Num() > 0; }))
+	{
+		// Nothing is connected anymore, so go back to a wildcard.
+		NewType = FEdGraphPinType();
+		NewType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+	}
+
+	if (NewType == ValuePinType)
+	{
+		return;
+	}
+
+	ValuePinType = NewType;
+	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+	for (UEdGraphPin* ValuePin : ValuePins)
+	{
+		ValuePin->PinType = ValuePinType;
+		if (ValuePin->Direction == EGPD_Input)
+		{
+			K2Schema->SetPinAutogeneratedDefaultValueBasedOnType(ValuePin);
+		}
+	}
+	GetGraph()->NotifyGraphChanged();
+}
+
+UK2Node::ERedirectType UECK2Node_SelectResult::DoPinsMatchForReconstruction(const UEdGraphPin* NewPin,
+	int32 NewPinIndex,
+	const UEdGraphPin* OldPin,
+	int32 OldPinIndex
+	) const
+{
+	// Nodes saved before case pins were named by result used 'Case_<index>'.
+	const FString OldPinName = OldPin->PinName.ToString();
+	if (OldPin->Direction == EGPD_Input && OldPinName.StartsWith(TEXT("Case_")))
+	{
+		const TArray<FName> CasePinNames = GetCaseOptionPinNames();
+		const int32 CaseIndex = FCString::Atoi(*OldPinName.RightChop(5));
+		if (CasePinNames.IsValidIndex(CaseIndex) && CasePinNames[CaseIndex] == NewPin->PinName)
+		{
+			return ERedirectType_Name;
+		}
+	}
+	return Super::DoPinsMatchForReconstruction(NewPin, NewPinIndex, OldPin, OldPinIndex);
+}
+
+void UECK2Node_SelectResult::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	if (ValuePinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+	{
+		// Reported by ValidateNodeDuringCompilation.
+		BreakAllNodeLinks();
+		return;
+	}
+
+	FECResultSwitchTable Table = BuildSwitchTable();
+	UECK2Node_CallSwitchResultLookup::ValidateTableKey(*this, Table, CompilerContext.MessageLog);
+
+	// One native call maps the selection to an option index, using the cases baked into the generated class.
+	const UFunction* LookupFunction = UECErrorFunctionLibrary::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UECErrorFunctionLibrary, GetSelectResultOptionIndex));
+	check(IsValid(LookupFunction));
+	UECK2Node_CallSwitchResultLookup* Lookup =
+		CompilerContext.SpawnIntermediateNode<UECK2Node_CallSwitchResultLookup>(this, SourceGraph);
+	Lookup->Table = MoveTemp(Table);
+	Lookup->SetFromFunction(LookupFunction);
+	Lookup->AllocateDefaultPins();
+	check(Lookup->IsNodePure());
+	Lookup->FindPinChecked(TEXT("TableKey"))->DefaultValue = FString::FromInt(Lookup->Table.Key);
+	// Options are 'Success', then the cases, then 'Default'.
+	Lookup->FindPinChecked(TEXT("DefaultIndex"))->DefaultValue = FString::FromInt(PinResultCodes.Num() + 1);
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GetSelectionPinName()), *Lookup->FindPinChecked(TEXT("Selection")));
+
+	// The engine's select node indexes the options with a switch in the VM, without any further calls.
+	UK2Node_Select* Select = CompilerContext.SpawnIntermediateNode<UK2Node_Select>(this, SourceGraph);
+	Select->AllocateDefaultPins();
+
+	TArray<UEdGraphPin*> ValuePins;
+	GetValuePins(ValuePins);
+	UEdGraphPin* ReturnPin = ValuePins.Pop();
+
+	TArray<UEdGraphPin*> SelectOptionPins;
+	Select->GetOptionPins(SelectOptionPins);
+	while (SelectOptionPins.Num() < ValuePins.Num())
+	{
+		Select->AddInputPin();
+		Select->GetOptionPins(SelectOptionPins);
+	}
+
+	UEdGraphPin* SelectIndexPin = Select->GetIndexPin();
+	SelectIndexPin->PinType.ResetToDefaults();
+	SelectIndexPin->PinType.PinCategory = UEdGraphSchema_K2::PC_Int;
+	Lookup->GetReturnValuePin()->MakeLinkTo(SelectIndexPin);
+
+	for (int32 OptionIndex = 0; OptionIndex < ValuePins.Num(); ++OptionIndex)
+	{
+		SelectOptionPins[OptionIndex]->PinType = ValuePinType;
+		CompilerContext.MovePinLinksToIntermediate(*ValuePins[OptionIndex], *SelectOptionPins[OptionIndex]);
+	}
+
+	UEdGraphPin* SelectReturnPin = Select->GetReturnValuePin();
+	SelectReturnPin->PinType = ValuePinType;
+	CompilerContext.MovePinLinksToIntermediate(*ReturnPin, *SelectReturnPin);
+
+	BreakAllNodeLinks();
+}
+
+void UECK2Node_SelectResult::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+FText UECK2Node_SelectResult::GetMenuCategory() const
+{
+	return LOCTEXT("MenuCategory", "ErrorHandling");
+}
+
+void UECK2Node_SelectResult::AddInputPin()
+{
+	Modify();
+	PinResultCodes.Add(FECResult());
+	ReconstructNode();
+}
+
+void UECK2Node_SelectResult::RemoveCase(int32 CaseIndex)
+{
+	if (!PinResultCodes.IsValidIndex(CaseIndex))
+	{
+		return;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("Transaction_RemoveCase", "Remove Case"));
+	Modify();
+	PinResultCodes.RemoveAt(CaseIndex);
+	ReconstructNode();
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(GetBlueprint());
+}
+
+FECResultSwitchTable UECK2Node_SelectResult::BuildSwitchTable() const
+{
+	FECResultSwitchTable Table;
+	Table.Cases = PinResultCodes;
+	Table.Key = Table.ComputeKey();
+	return Table;
+}
+
+void UECK2Node_SelectResult::GetValuePins(TArray<UEdGraphPin*>& OutPins) const
+{
+	OutPins.Reset(PinResultCodes.Num() + 3);
+	OutPins.Add(FindPinChecked(GetSuccessOptionPinName(), EGPD_Input));
+	for (const FName& CasePinName : GetCaseOptionPinNames())
+	{
+		OutPins.Add(FindPinChecked(CasePinName, EGPD_Input));
+	}
+	OutPins.Add(FindPinChecked(GetDefaultOptionPinName(), EGPD_Input));
+	OutPins.Add(FindPinChecked(UEdGraphSchema_K2::PN_ReturnValue, EGPD_Output));
+}
+
+FName UECK2Node_SelectResult::GetSelectionPinName()
+{
+	return TEXT("Selection");
+}
+
+FName UECK2Node_SelectResult::GetSuccessOptionPinName()
+{
+	return TEXT("EC_RESERVED_Success");
+}
+
+FName UECK2Node_SelectResult::GetDefaultOptionPinName()
+{
+	return TEXT("EC_RESERVED_Default");
+}
+
+TArray<FName> UECK2Node_SelectResult::GetCaseOptionPinNames() const
+{
+	TArray<FName> PinNames;
+	PinNames.Reserve(PinResultCodes.Num());
+	for (const FECResult& ResultCode : PinResultCodes)
+	{
+		// Use the path, since categories in different packages may share a name. Repeated cases (E.g., several new
+		// ones) are numbered in order.
+		const FString BaseName = FString::Printf(TEXT("EC_Case_%s_%lld"), *GetPathNameSafe(ResultCode.GetCategory()), ResultCode.GetValue());
+		FName PinName = *BaseName;
+		for (int32 Repeat = 1; PinNames.Contains(PinName); ++Repeat)
+		{
+			PinName = *FString::Printf(TEXT("%s_%d"), *BaseName, Repeat);
+		}
+		PinNames.Add(PinName);
+	}
+	return PinNames;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -6,12 +6,16 @@
 
 #include "ECK2Node_SwitchResult.h"
 
-#include "ECErrorFunctionLibrary.h"
 #include "BlueprintActionDatabaseRegistrar.h"
 #include "BlueprintNodeSpawner.h"
 #include "ECEditorLogging.h"
 #include "ECErrorFunctionLibrary.h"
 #include "ECErrorCategory.h"
+#include "ECK2Node_CallSwitchResultLookup.h"
+#include "ECResultSwitchBinding.h"
+#include "K2Node_BreakStruct.h"
+#include "K2Node_IfThenElse.h"
+#include "KismetCompiler.h"
 #include "Kismet2/CompilerResultsLog.h"
 
 #define LOCTEXT_NAMESPACE "ErrorHandlingEditor_K2NodeSwitchResult"
@@ -28,7 +32,9 @@ void UECK2Node_SwitchResult::PostEditChangeProperty(FPropertyChangedEvent& Prope
 {
 	bool bIsDirty = false;
 	const FName PropertyName = (PropertyChangedEvent.MemberProperty ? PropertyChangedEvent.MemberProperty->GetFName() : NAME_None);
-	if (PropertyName == GET_MEMBER_NAME_CHECKED(UECK2Node_SwitchResult, PinResultCodes))
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UECK2Node_SwitchResult, PinResultCodes)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UECK2Node_SwitchResult, PinGroupCases)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UECK2Node_SwitchResult, PinCategoryCases))
 	{
 		bIsDirty = true;
 	}
@@ -87,6 +93,31 @@ void UECK2Node_SwitchResult::ValidateNodeDuringCompilation(FCompilerResultsLog&
 			return;
 		}
 	}
+
+	// Group pins are named after their group, so names must be unique for each output to get its own pin.
+	TSet<FName> GroupNames;
+	for (const FECResultSwitchGroup& Group : PinGroupCases)
+	{
+		bool bIsAlreadyInSet = false;
+		GroupNames.Add(Group.Name, &bIsAlreadyInSet);
+		if (Group.Name.IsNone() || bIsAlreadyInSet || Group.Results.IsEmpty())
+		{
+			MessageLog.Error(*LOCTEXT("SwitchResult_InvalidGroup", "@@ contains groups which are unnamed, empty, or share a name.").ToString(), this);
+			return;
+		}
+	}
+
+	TSet<const UEnum*> Categories;
+	for (const UEnum* Category : PinCategoryCases)
+	{
+		bool bIsAlreadyInSet = false;
+		Categories.Add(Category, &bIsAlreadyInSet);
+		if (!Category || bIsAlreadyInSet)
+		{
+			MessageLog.Error(*LOCTEXT("SwitchResult_InvalidCategory", "@@ contains category cases which are empty or duplicated.").ToString(), this);
+			return;
+		}
+	}
 }
 
 void UECK2Node_SwitchResult::PreloadRequiredAssets()
@@ -96,6 +127,17 @@ void UECK2Node_SwitchResult::PreloadRequiredAssets()
 		UEnum* ErrorCategoryMut = const_cast<UEnum*>(ResultCode.GetCategory());
 		PreloadObject(ErrorCategoryMut);
 	}
+	for (const FECResultSwitchGroup& Group : PinGroupCases)
+	{
+		for (const FECResult& Result : Group.Results)
+		{
+			PreloadObject(const_cast<UEnum*>(Result.GetCategory()));
+		}
+	}
+	for (const UEnum* Category : PinCategoryCases)
+	{
+		PreloadObject(const_cast<UEnum*>(Category));
+	}
 	Super::PreloadRequiredAssets();
 }
 
@@ -119,6 +161,134 @@ void UECK2Node_SwitchResult::GetMenuActions(FBlueprintActionDatabaseRegistrar& A
 	}
 }
 
+void UECK2Node_SwitchResult::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	if (PinResultCodes.IsEmpty() && PinGroupCases.IsEmpty() && PinCategoryCases.IsEmpty())
+	{
+		// Nothing to look up: the default handler's single comparison against 'Success' is already cheapest.
+		return;
+	}
+
+	FECResultSwitchTable Table = BuildSwitchTable();
+	UECK2Node_CallSwitchResultLookup::ValidateTableKey(*this, Table, CompilerContext.MessageLog);
+
+	// Outputs in the order the lookup returns them: 'Success', each case, each group, each category, then 'Default'.
+	TArray<UEdGraphPin*> OutputPins;
+	OutputPins.Reserve(Table.GetNumOutputs());
+	OutputPins.Add(FindPinChecked(GetSuccessPinName(), EGPD_Output));
+	for (const FName& PinName : PinNames)
+	{
+		OutputPins.Add(FindPinChecked(PinName, EGPD_Output));
+	}
+	for (const FECResultSwitchGroup& Group : PinGroupCases)
+	{
+		OutputPins.Add(FindPinChecked(GetGroupPinName(Group), EGPD_Output));
+	}
+	for (const UEnum* Category : PinCategoryCases)
+	{
+		OutputPins.Add(FindPinChecked(GetCategoryPinName(Category), EGPD_Output));
+	}
+	OutputPins.Add(bHasDefaultPin ? GetDefaultPin() : nullptr);
+	check(OutputPins.Num() == Table.GetNumOutputs());
+
+	// Cases whose pins share a name would be wired to the same output.
+	if (TSet<UEdGraphPin*>(OutputPins).Num() != OutputPins.Num())
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("SwitchResult_DuplicatePins", "@@ has cases with the same pin name.").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	const int32 NumBits = FMath::CeilLogTwo(static_cast<uint32>(OutputPins.Num()));
+	if (NumBits > FECResultSwitchOutput::MaxBits)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("SwitchResult_TooManyCases", "@@ has too many cases.").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	// One native call maps the selection to an output index, using the cases baked into the generated class.
+	const UFunction* LookupFunction = UECErrorFunctionLibrary::StaticClass()->FindFunctionByName(
+		GET_FUNCTION_NAME_CHECKED(UECErrorFunctionLibrary, GetSwitchResultOutput));
+	check(IsValid(LookupFunction));
+	UECK2Node_CallSwitchResultLookup* Lookup =
+		CompilerContext.SpawnIntermediateNode<UECK2Node_CallSwitchResultLookup>(this, SourceGraph);
+	Lookup->Table = MoveTemp(Table);
+	Lookup->SetFromFunction(LookupFunction);
+	Lookup->AllocateDefaultPins();
+	Lookup->FindPinChecked(TEXT("TableKey"))->DefaultValue = FString::FromInt(Lookup->Table.Key);
+	Lookup->FindPinChecked(TEXT("DefaultIndex"))->DefaultValue = FString::FromInt(OutputPins.Num() - 1);
+
+	CompilerContext.MovePinLinksToIntermediate(*GetSelectionPin(), *Lookup->FindPinChecked(TEXT("Selection")));
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *Lookup->GetExecPin());
+
+	// Breaking the output struct reads its members in the VM, so the branches below make no further native calls.
+	UK2Node_BreakStruct* Break = CompilerContext.SpawnIntermediateNode<UK2Node_BreakStruct>(this, SourceGraph);
+	Break->StructType = FECResultSwitchOutput::StaticStruct();
+	Break->bMadeAfterOverridePinRemoval = true;
+	Break->AllocateDefaultPins();
+	Lookup->GetReturnValuePin()->MakeLinkTo(Break->FindPinChecked(Break->StructType->GetFName(), EGPD_Input));
+
+	TArray<UEdGraphPin*> BitPins;
+	for (int32 Bit = 0; Bit < NumBits; ++Bit)
+	{
+		BitPins.Add(Break->FindPinChecked(FECResultSwitchOutput::GetBitMemberName(Bit), EGPD_Output));
+	}
+
+	ExpandOutputBranches(CompilerContext, SourceGraph, BitPins, OutputPins, 0, NumBits - 1, Lookup->GetThenPin());
+
+	BreakAllNodeLinks();
+}
+
+void UECK2Node_SwitchResult::ExpandOutputBranches(FKismetCompilerContext& CompilerContext,
+	UEdGraph* SourceGraph,
+	TConstArrayView<UEdGraphPin*> BitPins,
+	TConstArrayView<UEdGraphPin*> OutputPins,
+	int32 FirstOutput,
+	int32 Bit,
+	UEdGraphPin* ExecPin
+	)
+{
+	if (Bit < 0)
+	{
+		// A missing 'Default' pin is left unconnected, so unmatched results end the execution path.
+		if (UEdGraphPin* OutputPin = OutputPins[FirstOutput])
+		{
+			CompilerContext.MovePinLinksToIntermediate(*OutputPin, *ExecPin);
+		}
+		return;
+	}
+
+	// Outputs with this bit set start here. If there are none, the bit is always clear and needs no branch.
+	const int32 UpperOutput = FirstOutput + (1 << Bit);
+	if (UpperOutput >= OutputPins.Num())
+	{
+		ExpandOutputBranches(CompilerContext, SourceGraph, BitPins, OutputPins, FirstOutput, Bit - 1, ExecPin);
+		return;
+	}
+
+	// Blueprint bytecode has no jump table, so branch on one bit of the index per level to reach any output.
+	UK2Node_IfThenElse* Branch = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+	Branch->AllocateDefaultPins();
+	BitPins[Bit]->MakeLinkTo(Branch->GetConditionPin());
+	ExecPin->MakeLinkTo(Branch->GetExecPin());
+
+	ExpandOutputBranches(CompilerContext, SourceGraph, BitPins, OutputPins, UpperOutput, Bit - 1, Branch->GetThenPin());
+	ExpandOutputBranches(CompilerContext, SourceGraph, BitPins, OutputPins, FirstOutput, Bit - 1, Branch->GetElsePin());
+}
+
+FECResultSwitchTable UECK2Node_SwitchResult::BuildSwitchTable() const
+{
+	FECResultSwitchTable Table;
+	Table.Cases = PinResultCodes;
+	Table.Groups = PinGroupCases;
+	Table.Categories = PinCategoryCases;
+	Table.Key = Table.ComputeKey();
+	return Table;
+}
+
 void UECK2Node_SwitchResult::AddPinToSwitchNode()
 {
 	FName PinName = GetUniquePinName();
@@ -173,7 +343,18 @@ bool UECK2Node_SwitchResult::DependsOnErrorCategory(const UECErrorCategory& Cate
 		}
 	}
 
-	return false;
+	for (const FECResultSwitchGroup& Group : PinGroupCases)
+	{
+		for (const FECResult& Result : Group.Results)
+		{
+			if (Result.GetCategory() == &Category)
+			{
+				return true;
+			}
+		}
+	}
+
+	return PinCategoryCases.Contains(&Category);
 }
 
 void UECK2Node_SwitchResult::ReloadErrorCategory(UECErrorCategory* Category)
@@ -219,6 +400,18 @@ int32 UECK2Node_SwitchResult::AddUniqueCodesFromCategory(const UEnum& Category)
 	return NumAdded;
 }
 
+bool UECK2Node_SwitchResult::AddCategoryCase(const UEnum& Category)
+{
+	if (PinCategoryCases.Contains(&Category))
+	{
+		return false;
+	}
+
+	PinCategoryCases.Add(&Category);
+	ReconstructNode();
+	return true;
+}
+
 void UECK2Node_SwitchResult::CreateFunctionPin()
 {
 	// Set properties on the function pin
@@ -276,6 +469,22 @@ void UECK2Node_SwitchResult::CreateCasePins()
 		
 		CasePin->PinToolTip = GetTooltipForErrorCodePin(PinResultCodes[Index]);
 	}
+
+	for (const FECResultSwitchGroup& Group : PinGroupCases)
+	{
+		UEdGraphPin* GroupPin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, GetGroupPinName(Group));
+		GroupPin->PinFriendlyName = FText::Format(LOCTEXT("FriendlyName_GroupPin", "Group: {0}"), FText::FromName(Group.Name));
+		GroupPin->PinToolTip = FString::Printf(TEXT("Any of the %d result(s) in the group '%s'."), Group.Results.Num(), *Group.Name.ToString());
+	}
+
+	for (const UEnum* Category : PinCategoryCases)
+	{
+		UEdGraphPin* CategoryPin = CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, GetCategoryPinName(Category));
+		// Any failing value gives the category name, whether or not it names an error.
+		const FText CategoryName = Category ? FECResult::ConstructRaw(Category, 1).GetCategoryName() : LOCTEXT("InvalidCategory", "[INVALID]");
+		CategoryPin->PinFriendlyName = FText::Format(LOCTEXT("FriendlyName_CategoryPin", "Any {0}"), CategoryName);
+		CategoryPin->PinToolTip = FString::Printf(TEXT("Any error in the category '%s'."), *CategoryName.ToString());
+	}
 }
 
 void UECK2Node_SwitchResult::RemovePin(UEdGraphPin* TargetPin)
@@ -292,6 +501,20 @@ void UECK2Node_SwitchResult::RemovePin(UEdGraphPin* TargetPin)
 			PinResultCodes.RemoveAt(Index);
 		}
 		PinNames.RemoveAt(Index);
+		return;
+	}
+
+	Index = PinGroupCases.IndexOfByPredicate([PinName](const FECResultSwitchGroup& Group) { return GetGroupPinName(Group) == PinName; });
+	if (Index != INDEX_NONE)
+	{
+		PinGroupCases.RemoveAt(Index);
+		return;
+	}
+
+	Index = PinCategoryCases.IndexOfByPredicate([PinName](const UEnum* Category) { return GetCategoryPinName(Category) == PinName; });
+	if (Index != INDEX_NONE)
+	{
+		PinCategoryCases.RemoveAt(Index);
 	}
 }
 
@@ -330,4 +553,15 @@ FName UECK2Node_SwitchResult::GetSuccessPinName()
 	return TEXT("EC_RESERVED_Success");
 }
 
+FName UECK2Node_SwitchResult::GetGroupPinName(const FECResultSwitchGroup& Group)
+{
+	return *FString::Printf(TEXT("EC_Group_%s"), *Group.Name.ToString());
+}
+
+FName UECK2Node_SwitchResult::GetCategoryPinName(const UEnum* Category)
+{
+	// Use the path, since categories in different packages may share a name.
+	return *FString::Printf(TEXT("EC_Category_%s"), *GetPathNameSafe(Category));
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -54,6 +54,9 @@ public:
 	static FName GetEnumInputPinName();
 
 private:
+	// Replace the node with a literal result, for when the enum input isn't linked.
+	void ExpandLiteral(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph);
+
 	/** Constructing FText strings can be costly, so we cache the node's tooltip */
 	FNodeTextCache CachedTooltip;
 };
@@ -0,0 +1,41 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "UObject/Object.h"
+#include "ECK2Node_PropagateFailure.generated.h"
+
+/**
+ * Blueprint equivalent of EC_VALIDATE: continues on success, else returns the failed result from the function.
+ *
+ * Only usable in functions which return an FECResult. Graph-level shorthand for Branch(IsFailure) -> Return, with the
+ * same runtime cost: a native IsFailure call and a conditional jump. 'Result' is copied to a local first, so a pure
+ * source is evaluated once instead of once for the test and again for the return.
+ */
+UCLASS(MinimalAPI)
+class UECK2Node_PropagateFailure : public UK2Node
+{
+	GENERATED_BODY()
+
+public:
+	// UEdGraphNode interface
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetTooltipText() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
+	virtual bool IsCompatibleWithGraph(const UEdGraph* TargetGraph) const override;
+	// End of UEdGraphNode interface
+
+	// UK2Node interface
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+	// End of UK2Node interface
+
+	static FName GetResultPinName();
+};
@@ -0,0 +1,87 @@
+// Copyright 2023 Miraganic Studios.
+// Use of this source code is governed by an MIT-style
+// license that can be found in the LICENSE file or at
+// https://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECResult.h"
+#include "ECResultSwitchBinding.h"
+#include "K2Node.h"
+#include "K2Node_AddPinInterface.h"
+#include "UObject/Object.h"
+#include "ECK2Node_SelectResult.generated.h"
+
+/**
+ * Blueprint node for picking a value based on a result: one option for 'Success', one per case, and a default.
+ *
+ * Compiles to one native lookup of the case table baked into the class, which indexes into a 'Select' node.
+ */
+UCLASS(MinimalAPI)
+class UECK2Node_SelectResult : public UK2Node, public IK2Node_AddPinInterface
+{
+	GENERATED_BODY()
+
+public:
+	UECK2Node_SelectResult(const FObjectInitializer& ObjectInitializer);
+
+	// UObject interface
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	// End of UObject interface
+
+	// UEdGraphNode interface
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetTooltipText() const override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual bool ShouldShowNodeProperties() const override { return true; }
+	virtual void GetNodeContextMenuActions(class UToolMenu* Menu, class UGraphNodeContextMenuContext* Context) const override;
+	virtual void ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const override;
+	virtual void PreloadRequiredAssets() override;
+	// End of UEdGraphNode interface
+
+	// UK2Node interface
+	virtual bool IsNodePure() const override { return true; }
+	virtual bool IsConnectionDisallowed(const UEdGraphPin* MyPin, const UEdGraphPin* OtherPin, FString& OutReason) const override;
+	virtual void NotifyPinConnectionListChanged(UEdGraphPin* Pin) override;
+	virtual ERedirectType DoPinsMatchForReconstruction(const UEdGraphPin* NewPin,
+		int32 NewPinIndex,
+		const UEdGraphPin* OldPin,
+		int32 OldPinIndex
+		) const override;
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+	// End of UK2Node interface
+
+	// IK2Node_AddPinInterface
+	virtual void AddInputPin() override;
+	// End of IK2Node_AddPinInterface
+
+	// Get the case table this node compiles to.
+	FECResultSwitchTable BuildSwitchTable() const;
+
+	// Remove a case and its option pin.
+	void RemoveCase(int32 CaseIndex);
+
+	UPROPERTY(EditAnywhere, Category = PinOptions)
+	TArray<FECResult> PinResultCodes;
+
+protected:
+	// Get the option pins in lookup order ('Success', each case, then 'Default'), followed by the return value.
+	void GetValuePins(TArray<UEdGraphPin*>& OutPins) const;
+
+	static FName GetSelectionPinName();
+	static FName GetSuccessOptionPinName();
+	static FName GetDefaultOptionPinName();
+
+	/**
+	 * Get the name of each case's option pin. Names are derived from the case's result rather than its position, so
+	 * removing or reordering cases keeps every other option's links.
+	 */
+	TArray<FName> GetCaseOptionPinNames() const;
+
+	// Type shared by the options and the return value. A wildcard until a value pin is connected.
+	UPROPERTY()
+	FEdGraphPinType ValuePinType;
+};
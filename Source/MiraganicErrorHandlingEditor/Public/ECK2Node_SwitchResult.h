@@ -8,6 +8,7 @@
 #include "CoreMinimal.h"
 #include "K2Node_Switch.h"
 #include "ECResult.h"
+#include "ECResultSwitchBinding.h"
 #include "IECNodeDependingOnErrorCategory.h"
 #include "UObject/Object.h"
 #include "ECK2Node_SwitchResult.generated.h"
@@ -39,6 +40,7 @@ public:
 
 	// UK2Node interface
 	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
 	// End of UK2Node interface
 
 	// UK2Node_Switch Interface
@@ -62,6 +64,15 @@ public:
 	 */
 	int32 AddUniqueCodesFromCategory(const UEnum& Category);
 
+	/**
+	 * Add a pin which matches every error in a category.
+	 * @return Whether the pin was added (false if the category already has one).
+	 */
+	bool AddCategoryCase(const UEnum& Category);
+
+	// Get the case table this node compiles to.
+	FECResultSwitchTable BuildSwitchTable() const;
+
 protected:
 	virtual void CreateFunctionPin() override;
 	virtual void CreateSelectionPin() override;
@@ -72,11 +83,32 @@ protected:
 	FString GetTooltipForErrorCodePin(const FECResult& ErrorCode) const;
 
 	static FName GetSuccessPinName();
+	static FName GetGroupPinName(const FECResultSwitchGroup& Group);
+	static FName GetCategoryPinName(const UEnum* Category);
+
+private:
+	// Expand branches over the outputs whose index matches 'FirstOutput' above 'Bit', given the lookup's index bits.
+	void ExpandOutputBranches(class FKismetCompilerContext& CompilerContext,
+		UEdGraph* SourceGraph,
+		TConstArrayView<UEdGraphPin*> BitPins,
+		TConstArrayView<UEdGraphPin*> OutputPins,
+		int32 FirstOutput,
+		int32 Bit,
+		UEdGraphPin* ExecPin
+		);
 
 public:
 	UPROPERTY(EditAnywhere, Category = PinOptions)
 	TArray<FECResult> PinResultCodes;
 
+	// Cases which match any result in a named group.
+	UPROPERTY(EditAnywhere, Category = PinOptions)
+	TArray<FECResultSwitchGroup> PinGroupCases;
+
+	// Cases which match any error in a category.
+	UPROPERTY(EditAnywhere, Category = PinOptions)
+	TArray<TObjectPtr<const UEnum>> PinCategoryCases;
+
 	UPROPERTY()
 	TArray<FName> PinNames;
 };